@@ -0,0 +1,103 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include "cafea/base/base.hpp"
+
+namespace cafea {
+/**
+ *  \brief Get storage of pool.
+ */
+StringPool::Data& StringPool::data() {
+	static Data d;
+	return d;
+}
+/**
+ *  \brief Get index and address of string, string is added when it is new.
+ *  \param[in] s string.
+ *  \param[out] p address of string in pool.
+ *  \return index of string.
+ */
+uint32_t StringPool::intern(const std::string &s, const std::string **p) {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	auto got = d.index.emplace(s, static_cast<uint32_t>(d.str.size()));
+	if (got.second) d.str.push_back(s);
+	*p = &d.str[got.first->second];
+	return got.first->second;
+}
+/**
+ *  \brief Get index of string, string is added when it is new.
+ */
+uint32_t StringPool::intern(const std::string &s) {
+	const std::string *p{nullptr};
+	return intern(s, &p);
+}
+/**
+ *  \brief Get index of string.
+ *
+ *  Objects of one kind are usually created in a row, so last string of the
+ *  thread is compared first without lock.
+ */
+uint32_t StringPool::intern(const char *s) {
+	thread_local const std::string *last{nullptr};
+	thread_local uint32_t idx{0};
+	if (nullptr != last && 0 == last->compare(s)) return idx;
+	idx = intern(std::string(s), &last);
+	return idx;
+}
+/**
+ *  \brief Get string of index.
+ */
+std::string StringPool::get(uint32_t i) {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	assert(i < d.str.size());
+	return d.str[i];
+}
+/**
+ *  \brief Get number of strings.
+ */
+size_t StringPool::size() {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	return d.str.size();
+}
+/**
+ *  \brief Get storage of table.
+ */
+ObjectTable::Data& ObjectTable::data() {
+	static Data d;
+	return d;
+}
+/**
+ *  \brief Get attributes of object.
+ *  \param[in] kind kind of object.
+ *  \param[in] id id of object.
+ *  \return attributes, empty tags and zero groups when none is set.
+ */
+ObjectTable::Attr ObjectTable::get(uint32_t kind, int id) {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	auto got = d.attr.find(key(kind, id));
+	return got == d.attr.end() ? Attr(): got->second;
+}
+/**
+ *  \brief Clear attributes of all objects.
+ */
+void ObjectTable::clear() {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	d.attr.clear();
+}
+/**
+ *  \brief Get number of objects with attributes.
+ */
+size_t ObjectTable::size() {
+	auto &d = data();
+	std::lock_guard<std::mutex> lock(d.mtx);
+	return d.attr.size();
+}
+}  // namespace cafea
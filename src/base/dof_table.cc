@@ -0,0 +1,33 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/base/dof_table.hpp"
+
+namespace cafea {
+/**
+ *  \brief Append dofs of node.
+ *  \param[in] id node id.
+ *  \param[in] dofs equations of dofs, negative DofType when constrained.
+ *  \return index of node, the existing one when id is duplicated.
+ */
+size_t DofTable::add(int id, const std::vector<int> &dofs) {
+	const size_t i = id_.size();
+	auto got = index_.emplace(id, i);
+	if (!got.second) {
+		fmt::print("Duplicate node id {} in dof table.\n", id);
+		return got.first->second;
+	}
+	id_.push_back(id);
+	dof_.insert(dof_.end(), dofs.begin(), dofs.end());
+	ptr_.push_back(dof_.size());
+	for (auto v: dofs) dim_ = std::max(dim_, v+1);
+	return i;
+}
+}  // namespace cafea
@@ -53,6 +53,14 @@ void Node<T, U>::init_result(SolutionType sol, int n) {
 			this->disp_cmplx_ = matrix_<COMPLEX<U>>::Zero(m, n);
 			this->stress_cmplx_ = matrix_<COMPLEX<U>>::Zero(8, n);
 			break;
+		case SolutionType::SPECTRUM:
+			this->disp_ = matrix_<U>::Zero(m, 1);
+			break;
+		case SolutionType::TRANSIENT:
+			this->disp_ = matrix_<U>::Zero(m, 1);
+			this->vel_ = matrix_<U>::Zero(m, 1);
+			this->accel_ = matrix_<U>::Zero(m, 1);
+			break;
 		case SolutionType::HARMONIC_MODAL_SUPERPOSITION:
 		default: fmt::print("Unsupported solution type definition\n");
 	}
@@ -81,6 +89,20 @@ void Node<T, U>::set_result(SolutionType sol, LoadType lt, int n, matrix_<U> rst
 				default: fmt::print("Unsupported result type\n");
 			}
 			break;
+		case SolutionType::SPECTRUM:
+			switch (lt) {
+				case LoadType::DISP: this->disp_ = rst; break;
+				default: fmt::print("Unsupported result type\n");
+			}
+			break;
+		case SolutionType::TRANSIENT:
+			switch (lt) {
+				case LoadType::DISP: this->disp_ = rst; break;
+				case LoadType::VEL: this->vel_ = rst; break;
+				case LoadType::ACCEL: this->accel_ = rst; break;
+				default: fmt::print("Unsupported result type\n");
+			}
+			break;
 		case SolutionType::HARMONIC_FULL:
 		case SolutionType::HARMONIC_MODAL_SUPERPOSITION:
 		default: fmt::print("Unsupported solution type definition\n");
@@ -100,7 +122,8 @@ matrix_<U> Node<T, U>::get_result(SolutionType sol, LoadType lt, int n) const {
 	if (!this->is_activated()) return tmp;
 
 	switch (sol) {
-		case SolutionType::STATIC: tmp = this->disp_; break;
+		case SolutionType::STATIC:
+		case SolutionType::SPECTRUM: tmp = this->disp_; break;
 		case SolutionType::MODAL:
 			if (0 > n) {
 				tmp = this->disp_;
@@ -108,6 +131,14 @@ matrix_<U> Node<T, U>::get_result(SolutionType sol, LoadType lt, int n) const {
 				tmp = this->disp_.col(n);
 			}
 			break;
+		case SolutionType::TRANSIENT:
+			switch (lt) {
+				case LoadType::DISP: tmp = this->disp_; break;
+				case LoadType::VEL: tmp = this->vel_; break;
+				case LoadType::ACCEL: tmp = this->accel_; break;
+				default: fmt::print("Unsupported result type\n");
+			}
+			break;
 		case SolutionType::HARMONIC_FULL:
 		case SolutionType::HARMONIC_MODAL_SUPERPOSITION:
 		default: fmt::print("Unsupported solution type definition\n");
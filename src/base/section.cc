@@ -38,7 +38,7 @@ Scalar Section<Scalar>::get_sect_prop(SectionProp sp) const {
 		case(SectionProp::OD):
 		case(SectionProp::ADDONMASS):
 		case(SectionProp::ADDONSPRING): val = this->param_[0]; break;
-		case(SectionProp::TKWALL): 		val = this->param_[1]; break;
+		case(SectionProp::TKWALL): 		val = SectionType::SHELL == sect_ ? this->param_[0]: this->param_[1]; break;
 		case(SectionProp::RADCUR): 		val = this->param_[2]; break;
 		case(SectionProp::DENSFL): 		val = this->param_[3]; break;
 		case(SectionProp::PRESIN): 		val = this->param_[4]; break;
@@ -0,0 +1,141 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cassert>
+
+#include "cafea/base/block_tran.hpp"
+
+namespace cafea {
+/**
+ *  \brief Detect pattern of transform matrix.
+ *  \param[in] tran transform matrix.
+ *  \return identity, block diagonal with 3x3 blocks or dense.
+ *
+ *  Entries are compared exactly, since element kernels fill zeros and ones
+ *  explicitly.
+ */
+template <class T>
+TranPattern BlockTran<T>::get_pattern(const Eigen::Ref<const matrix_<T>> &tran) {
+	const Eigen::Index n = tran.rows();
+	if (n != tran.cols() || 0 == n) return TranPattern::DENSE;
+	bool is_eye{true}, is_blk{0 == n%3};
+	for (Eigen::Index j = 0; j < n; j++) {
+		for (Eigen::Index i = 0; i < n; i++) {
+			const T v = tran(i, j);
+			if (i == j ? T(1) != v: T(0) != v) is_eye = false;
+			if (i/3 != j/3 && T(0) != v) is_blk = false;
+		}
+	}
+	if (is_eye) return TranPattern::IDENTITY;
+	return is_blk ? TranPattern::BLOCK_DIAGONAL: TranPattern::DENSE;
+}
+
+/**
+ *  \brief Fused transform of stiffness, mass and rhs.
+ *  \param[in] tran transform matrix.
+ *  \param[in] pat pattern of transform matrix.
+ *  \param[in] stif stiffness matrix in local coordinate.
+ *  \param[in] mass mass matrix in local coordinate.
+ *  \param[in] rhs right-hand side in local coordinate.
+ *  \param[out] stif_g stiffness matrix in global coordinate.
+ *  \param[out] mass_g mass matrix in global coordinate.
+ *  \param[out] rhs_g right-hand side in global coordinate.
+ *
+ *  Outputs must not alias inputs. Each rotation is loaded once per block
+ *  column and shared by stiffness and mass. Empty mass or rhs is not
+ *  requested by solution, and its output is set to zero.
+ */
+template <class T>
+void BlockTran<T>::transform(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+	const Eigen::Ref<const matrix_<T>> &stif, const Eigen::Ref<const matrix_<T>> &mass,
+	const Eigen::Ref<const vecX_<T>> &rhs, Eigen::Ref<matrix_<T>> stif_g,
+	Eigen::Ref<matrix_<T>> mass_g, Eigen::Ref<vecX_<T>> rhs_g) {
+	const bool has_mass = 0 < mass.size(), has_rhs = 0 < rhs.size();
+	assert(tran.rows() == stif.rows() && (!has_mass || tran.rows() == mass.rows()));
+	assert(!has_rhs || tran.rows() == rhs.size());
+	if (!has_mass) mass_g.setZero();
+	if (!has_rhs) rhs_g.setZero();
+	switch (pat) {
+		case TranPattern::IDENTITY:
+			stif_g = stif;
+			if (has_mass) mass_g = mass;
+			if (has_rhs) rhs_g = rhs;
+			break;
+		case TranPattern::BLOCK_DIAGONAL: {
+			const Eigen::Index nb = tran.rows()/3;
+			for (Eigen::Index j = 0; j < nb; j++) {
+				const mat3_<T> rj = tran.template block<3, 3>(3*j, 3*j);
+				if (has_rhs) rhs_g.template segment<3>(3*j).noalias() = rj.transpose()*rhs.template segment<3>(3*j);
+				for (Eigen::Index i = 0; i < nb; i++) {
+					const mat3_<T> ri = tran.template block<3, 3>(3*i, 3*i);
+					const mat3_<T> kr = stif.template block<3, 3>(3*i, 3*j)*rj;
+					stif_g.template block<3, 3>(3*i, 3*j).noalias() = ri.transpose()*kr;
+					if (!has_mass) continue;
+					const mat3_<T> mr = mass.template block<3, 3>(3*i, 3*j)*rj;
+					mass_g.template block<3, 3>(3*i, 3*j).noalias() = ri.transpose()*mr;
+				}
+			}
+			break;
+		}
+		case TranPattern::DENSE:
+		case TranPattern::UNKNOWN:
+		default:
+			stif_g.noalias() = tran.transpose()*(stif*tran);
+			if (has_mass) mass_g.noalias() = tran.transpose()*(mass*tran);
+			if (has_rhs) rhs_g.noalias() = tran.transpose()*rhs;
+	}
+}
+
+/**
+ *  \brief Multiply transform matrix.
+ *  \param[in] tran transform matrix.
+ *  \param[in] pat pattern of transform matrix.
+ *  \param[in] x global vectors in columns.
+ *  \param[out] y local vectors in columns, must not alias x.
+ */
+template <class T>
+void BlockTran<T>::apply(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+	const Eigen::Ref<const matrix_<T>> &x, Eigen::Ref<matrix_<T>> y) {
+	assert(tran.cols() == x.rows());
+	switch (pat) {
+		case TranPattern::IDENTITY: y = x; break;
+		case TranPattern::BLOCK_DIAGONAL:
+			for (Eigen::Index i = 0; i < tran.rows()/3; i++) {
+				const mat3_<T> ri = tran.template block<3, 3>(3*i, 3*i);
+				y.template middleRows<3>(3*i).noalias() = ri*x.template middleRows<3>(3*i);
+			}
+			break;
+		case TranPattern::DENSE:
+		case TranPattern::UNKNOWN:
+		default: y.noalias() = tran*x;
+	}
+}
+
+/**
+ *  \brief Multiply transpose of transform matrix.
+ *  \param[in] tran transform matrix.
+ *  \param[in] pat pattern of transform matrix.
+ *  \param[in] x local vectors in columns.
+ *  \param[out] y global vectors in columns, must not alias x.
+ */
+template <class T>
+void BlockTran<T>::apply_transpose(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+	const Eigen::Ref<const matrix_<T>> &x, Eigen::Ref<matrix_<T>> y) {
+	assert(tran.rows() == x.rows());
+	switch (pat) {
+		case TranPattern::IDENTITY: y = x; break;
+		case TranPattern::BLOCK_DIAGONAL:
+			for (Eigen::Index i = 0; i < tran.rows()/3; i++) {
+				const mat3_<T> ri = tran.template block<3, 3>(3*i, 3*i);
+				y.template middleRows<3>(3*i).noalias() = ri.transpose()*x.template middleRows<3>(3*i);
+			}
+			break;
+		case TranPattern::DENSE:
+		case TranPattern::UNKNOWN:
+		default: y.noalias() = tran.transpose()*x;
+	}
+}
+}  // namespace cafea
@@ -19,7 +19,20 @@ namespace cafea {
  */
 template <class T, class U>
 varargout_2_<U> NodeFunc<T, U>::coord_tran(const NodeBase<T> *p1, const NodeBase<T> *p2) {
-	matrix_<U> tran = matrix_<U>::Zero(3, 3);
+	mat3_<U> tran;
+	U length = NodeFunc<T, U>::coord_tran(p1, p2, tran);
+	return make_tuple(length, matrix_<U>(tran));
+}
+/**
+ *  \brief Coordinate transform for 2-node pipe element without heap allocation.
+ *  \param [in] p1 Start node.
+ *  \param [in] p2 End node.
+ *  \param [out] tran transform matrix of element.
+ *  \return length of element.
+ */
+template <class T, class U>
+U NodeFunc<T, U>::coord_tran(const NodeBase<T> *p1, const NodeBase<T> *p2, mat3_<U> &tran) {
+	tran.setZero();
 	vec3_<T> vxx, vxy, vyy, vzz;
 
 	vxx = p2->get_xyz() - p1->get_xyz();
@@ -41,7 +54,34 @@ varargout_2_<U> NodeFunc<T, U>::coord_tran(const NodeBase<T> *p1, const NodeBase
 		tran.row(2) << -vxx(0)*vxx(2)/A, -vxx(1)*vxx(2)/A, A;
 	}
 
-	return make_tuple(length, tran);
+	return length;
+}
+/**
+ *  \brief Coordinate transform for 2-node element in plane of third node.
+ *  \param [in] p1 Start node.
+ *  \param [in] p2 End node.
+ *  \param [in] p3 Node in plane of element, e.g. center of elbow.
+ *  \param [out] tran transform matrix of element.
+ *  \return distance between start and end node.
+ */
+template <class T, class U>
+U NodeFunc<T, U>::coord_tran(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *p3, mat3_<U> &tran) {
+	vec3_<T> vxx, vyy, vzz, vxy;
+	vxy = p3->get_xyz() - p1->get_xyz();
+	vxx = p2->get_xyz() - p1->get_xyz();
+
+	U length = vxx.norm();
+	assert(length>(EPS<U>()));
+	vxx /= vxx.norm();
+	vzz = vxx.cross(vxy);
+	vzz /= vzz.norm();
+	vyy = vzz.cross(vxx);
+	vyy /= vyy.norm();
+
+	tran.row(0) << vxx(0), vxx(1), vxx(2);
+	tran.row(1) << vyy(0), vyy(1), vyy(2);
+	tran.row(2) << vzz(0), vzz(1), vzz(2);
+	return length;
 }
 /**
  *  \brief Coordinate transform for 2-node beam with up-axis.
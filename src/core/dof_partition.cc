@@ -0,0 +1,36 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "cafea/base/dof_partition.hpp"
+
+namespace cafea {
+/**
+ *  \brief Split dofs into free and prescribed sets.
+ *  \param[in] dim dimension of global matrix.
+ *  \param[in] fixed global index of prescribed dofs, duplicates allowed.
+ */
+void DofPartition::init(size_t dim, std::vector<size_t> fixed) {
+	this->clear();
+	std::sort(fixed.begin(), fixed.end());
+	fixed.erase(std::unique(fixed.begin(), fixed.end()), fixed.end());
+	assert(fixed.empty() || fixed.back() < dim);
+	index_.resize(dim);
+	free_.reserve(dim-fixed.size());
+	fixed_ = std::move(fixed);
+	auto p = fixed_.begin();
+	for (size_t i = 0; i < dim; i++) {
+		if (p != fixed_.end() && *p == i) {
+			index_[i] = -static_cast<int>(std::distance(fixed_.begin(), p))-1;
+			p++;
+		} else {
+			index_[i] = static_cast<int>(free_.size());
+			free_.push_back(i);
+		}
+	}
+}
+}  // namespace cafea
@@ -0,0 +1,88 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <limits>
+
+#include "cafea/base/envelope.hpp"
+
+namespace cafea {
+/**
+ *  \brief Initialize envelope.
+ *  \param[in] id ids of items.
+ *  \param[in] num_row number of rows of each item.
+ */
+template <class T>
+void Envelope<T>::init(const std::vector<int> &id, int num_row) {
+	assert(0 <= num_row);
+	this->clear();
+	id_ = id;
+	for (size_t i = 0; i < id_.size(); i++) index_.emplace(id_[i], i);
+	assert(index_.size() == id_.size());
+	const auto n = static_cast<Eigen::Index>(id_.size());
+	max_ = matrix_<T>::Constant(num_row, n, std::numeric_limits<T>::lowest());
+	min_ = matrix_<T>::Constant(num_row, n, std::numeric_limits<T>::max());
+	max_step_ = matrix_<int>::Constant(num_row, n, -1);
+	min_step_ = matrix_<int>::Constant(num_row, n, -1);
+}
+
+/**
+ *  \brief Update item with values of steps.
+ *  \param[in] i index of item.
+ *  \param[in] step0 step of first column.
+ *  \param[in] val values, rows beyond val are not changed.
+ */
+template <class T>
+void Envelope<T>::update(size_t i, int step0, const Eigen::Ref<const matrix_<T>> &val) {
+	assert(i < id_.size() && val.rows() <= max_.rows());
+	const auto c = static_cast<Eigen::Index>(i);
+	for (Eigen::Index k = 0; k < val.cols(); k++) {
+		const int step = step0+static_cast<int>(k);
+		for (Eigen::Index r = 0; r < val.rows(); r++) {
+			const T v = val(r, k);
+			if (v > max_(r, c)) {
+				max_(r, c) = v;
+				max_step_(r, c) = step;
+			}
+			if (v < min_(r, c)) {
+				min_(r, c) = v;
+				min_step_(r, c) = step;
+			}
+		}
+	}
+}
+
+/**
+ *  \brief Update item with magnitude of complex values of steps.
+ */
+template <class T>
+void Envelope<T>::update(size_t i, int step0, const Eigen::Ref<const cmatrix_<T>> &val) {
+	matrix_<T> amp = val.cwiseAbs();
+	this->update(i, step0, amp);
+}
+
+/**
+ *  \brief Merge envelope of same items and rows.
+ *  \param[in] other envelope over other steps, ties keep the earlier step.
+ */
+template <class T>
+void Envelope<T>::merge(const Envelope &other) {
+	assert(id_ == other.id_ && max_.rows() == other.max_.rows());
+	for (Eigen::Index c = 0; c < max_.cols(); c++) {
+		for (Eigen::Index r = 0; r < max_.rows(); r++) {
+			const int sa = other.max_step_(r, c), si = other.min_step_(r, c);
+			const T a = other.max_(r, c), b = other.min_(r, c);
+			if (0 <= sa && (a > max_(r, c) || (a == max_(r, c) && sa < max_step_(r, c)))) {
+				max_(r, c) = a;
+				max_step_(r, c) = sa;
+			}
+			if (0 <= si && (b < min_(r, c) || (b == min_(r, c) && si < min_step_(r, c)))) {
+				min_(r, c) = b;
+				min_step_(r, c) = si;
+			}
+		}
+	}
+}
+}  // namespace cafea
@@ -0,0 +1,207 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/base/krylov_mor.hpp"
+
+namespace cafea {
+/**
+ *  \brief Load stiffness and mass matrix.
+ *  \param[in] stif global stiffness matrix.
+ *  \param[in] mass global mass matrix.
+ *  \param[in] damp structural damping ratio, i.e. \f$ K(1+i\eta) \f$.
+ */
+template <class T>
+void KrylovReducer<T>::load(const Eigen::SparseMatrix<T> &stif, const Eigen::SparseMatrix<T> &mass, T damp) {
+	this->clear();
+	assert(stif.rows() == stif.cols());
+	assert(stif.rows() == mass.rows() && stif.cols() == mass.cols());
+	damp_ = damp;
+	matK_ = stif.template cast<COMPLEX<T>>()*COMPLEX<T>(T(1), damp);
+	matM_ = mass.template cast<COMPLEX<T>>();
+	matK_.makeCompressed();
+	matM_.makeCompressed();
+}
+
+/**
+ *  \brief Load right hand side.
+ *  \param[in] rhs one column per load case.
+ *
+ *  Linear dependent load cases share the same input block.
+ */
+template <class T>
+void KrylovReducer<T>::set_rhs(const cmatrix_<T> &rhs) {
+	assert(rhs.rows() == matK_.rows());
+	rhs_ = rhs;
+	V_.resize(0, 0);
+	points_.clear();
+	Eigen::ColPivHouseholderQR<cmatrix_<T>> qr(rhs);
+	qr.setThreshold(std::sqrt(EPS<T>()));
+	auto rank = qr.rank();
+	cmatrix_<T> q_full = qr.householderQ();
+	input_ = q_full.leftCols(rank);
+}
+
+/**
+ *  \brief Orthogonalize block against basis and append.
+ *  \param[in,out] W block of new directions.
+ *  \return number of columns appended to basis.
+ */
+template <class T>
+size_t KrylovReducer<T>::append_basis(cmatrix_<T> &W) {
+	const T tol = std::sqrt(EPS<T>());
+	const auto dim = matK_.rows();
+	size_t num{0};
+	for (int j = 0; j < W.cols(); j++) {
+		if (V_.cols() >= dim) break;
+		vecX_<COMPLEX<T>> w = W.col(j);
+		T w0 = w.norm();
+		if (w0 <= T(0)) continue;
+		// Classical Gram-Schmidt twice is enough.
+		for (int pass = 0; pass < 2 && 0 < V_.cols(); pass++) {
+			vecX_<COMPLEX<T>> h = V_.adjoint()*w;
+			w -= V_*h;
+		}
+		T w1 = w.norm();
+		if (w1 < tol*w0) continue;
+		V_.conservativeResize(dim, V_.cols()+1);
+		V_.col(V_.cols()-1) = w/w1;
+		num++;
+	}
+	return num;
+}
+
+/**
+ *  \brief Project full matrices onto basis.
+ */
+template <class T>
+void KrylovReducer<T>::project() {
+	KV_ = matK_*V_;
+	MV_ = matM_*V_;
+	Kr_ = V_.adjoint()*KV_;
+	Mr_ = V_.adjoint()*MV_;
+	Fr_ = V_.adjoint()*rhs_;
+}
+
+/**
+ *  \brief Add expansion frequency.
+ *  \param[in] freq expansion frequency in Hz.
+ *  \param[in] num_moment number of block moments matched.
+ *  \return false when factorization failed.
+ */
+template <class T>
+bool KrylovReducer<T>::expand(T freq, int num_moment) {
+	if (1 > input_.cols()) {
+		fmt::print("Empty right hand side.\n");
+		return false;
+	}
+	const T omega = T(2)*PI<T>()*freq;
+	Eigen::SparseMatrix<COMPLEX<T>> mat_a = matK_ - COMPLEX<T>(omega*omega)*matM_;
+	Eigen::SparseLU<Eigen::SparseMatrix<COMPLEX<T>>, Eigen::COLAMDOrdering<int>> solver;
+	solver.compute(mat_a);
+	if (solver.info() != Eigen::ComputationInfo::Success) {
+		fmt::print("Decomposition Failed at expansion frequency: {}\n", freq);
+		return false;
+	}
+	cmatrix_<T> W = solver.solve(input_);
+	for (int k = 0; k < num_moment; k++) {
+		auto num = append_basis(W);
+		if (0 == num || k+1 == num_moment) break;
+		cmatrix_<T> MW = matM_*V_.rightCols(num);
+		W = solver.solve(MW);
+	}
+	points_.push_back(freq);
+	project();
+	return true;
+}
+
+/**
+ *  \brief Adaptive multi-point expansion in frequency band.
+ *  \param[in] freq_lb lower bound of band in Hz.
+ *  \param[in] freq_ub upper bound of band in Hz.
+ *  \param[in] tol tolerance of relative residual.
+ *  \param[in] num_moment number of block moments per expansion point.
+ *  \param[in] max_point maximum number of expansion points.
+ *  \param[in] num_sample number of frequencies checked by error estimator.
+ *  \return true when residual of all samples is below tolerance.
+ */
+template <class T>
+bool KrylovReducer<T>::reduce(T freq_lb, T freq_ub, T tol, int num_moment, int max_point, int num_sample) {
+	assert(freq_lb <= freq_ub);
+	if (2 > num_sample) num_sample = 2;
+	if (points_.empty() && !expand(T(0.5)*(freq_lb+freq_ub), num_moment)) return false;
+	while (true) {
+		T err_max{-1}, freq_max{freq_lb};
+		for (int i = 0; i < num_sample; i++) {
+			T freq = freq_lb+(freq_ub-freq_lb)*T(i)/T(num_sample-1);
+			T err = estimate(freq);
+			if (err > err_max) {
+				err_max = err;
+				freq_max = freq;
+			}
+		}
+		fmt::print("Expansion points: {}\tReduced dimension: {}\tMax residual: {:.3e} at {}Hz\n",
+			points_.size(), V_.cols(), err_max, freq_max);
+		if (err_max <= tol) return true;
+		if (max_point <= static_cast<int>(points_.size())) return false;
+		if (V_.cols() >= matK_.rows()) return false;
+		auto got = std::find(points_.begin(), points_.end(), freq_max);
+		if (got != points_.end()) return false;
+		if (!expand(freq_max, num_moment)) return false;
+	}
+}
+
+/**
+ *  \brief Solve reduced model.
+ *  \param[in] freq frequency in Hz.
+ *  \return full space solution of all load cases.
+ */
+template <class T>
+cmatrix_<T> KrylovReducer<T>::solve(T freq) const {
+	if (1 > V_.cols()) return cmatrix_<T>::Zero(matK_.rows(), rhs_.cols());
+	const T omega = T(2)*PI<T>()*freq;
+	cmatrix_<T> mat_a = Kr_-COMPLEX<T>(omega*omega)*Mr_;
+	cmatrix_<T> y = mat_a.partialPivLu().solve(Fr_);
+	return V_*y;
+}
+
+/**
+ *  \brief Solve reduced model.
+ *  \param[in] freq frequency in Hz.
+ *  \param[in] col index of load case.
+ *  \return full space solution.
+ */
+template <class T>
+vecX_<COMPLEX<T>> KrylovReducer<T>::solve(T freq, size_t col) const {
+	assert(col < static_cast<size_t>(rhs_.cols()));
+	if (1 > V_.cols()) return vecX_<COMPLEX<T>>::Zero(matK_.rows());
+	const T omega = T(2)*PI<T>()*freq;
+	cmatrix_<T> mat_a = Kr_-COMPLEX<T>(omega*omega)*Mr_;
+	vecX_<COMPLEX<T>> y = mat_a.partialPivLu().solve(Fr_.col(col));
+	return V_*y;
+}
+
+/**
+ *  \brief Error estimator of reduced model.
+ *  \param[in] freq frequency in Hz.
+ *  \return \f$ \|F-A(\omega)Vy\|/\|F\| \f$.
+ */
+template <class T>
+T KrylovReducer<T>::estimate(T freq) const {
+	T f_norm = rhs_.norm();
+	if (f_norm <= T(0)) return T(0);
+	if (1 > V_.cols()) return T(1);
+	const T omega = T(2)*PI<T>()*freq;
+	const COMPLEX<T> omega2(omega*omega);
+	cmatrix_<T> mat_a = Kr_-omega2*Mr_;
+	cmatrix_<T> y = mat_a.partialPivLu().solve(Fr_);
+	cmatrix_<T> res = rhs_-(KV_-omega2*MV_)*y;
+	return res.norm()/f_norm;
+}
+}  // namespace cafea
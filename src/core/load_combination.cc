@@ -0,0 +1,94 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "cafea/base/load_combination.hpp"
+
+namespace cafea {
+/**
+ *  \brief Add combination.
+ *  \param[in] rule rule of combination.
+ *  \param[in] term factored load cases and earlier combinations.
+ *  \return index of combination.
+ */
+template <class T>
+int LoadCombination<T>::add(CombinationRule rule, const std::vector<Term> &term) {
+	assert(0 < num_case_ && !term.empty());
+	for (const auto &it: term) {
+		assert(0 <= it.src && it.src < num_case_+get_num_combination());
+	}
+	rule_.push_back(rule);
+	term_.insert(term_.end(), term.begin(), term.end());
+	ptr_.push_back(term_.size());
+	return get_num_combination()-1;
+}
+
+/**
+ *  \brief Evaluate combinations in place.
+ *  \param[in,out] val results of load cases in the first num_case*width
+ *  columns, combinations are written to the following columns.
+ *  \param[in] width number of columns of each case, such as node I and J.
+ *  \param[in] skip_linear linear combinations are filled by caller.
+ *
+ *  Linear combinations of stresses are not linear in stresses, so callers
+ *  recompute them from combined forces and skip them here.
+ */
+template <class T>
+void LoadCombination<T>::evaluate(Eigen::Ref<matrix_<T>> val, int width, bool skip_linear) const {
+	assert(0 < width && val.cols() == (num_case_+get_num_combination())*width);
+	for (int j = 0; j < get_num_combination(); j++) {
+		const auto rule = rule_[j];
+		if (skip_linear && CombinationRule::LINEAR == rule) continue;
+		auto dst = val.middleCols((num_case_+j)*width, width).array();
+		for (size_t k = ptr_[j]; k < ptr_[j+1]; k++) {
+			const auto src = val.middleCols(term_[k].src*width, width).array()*term_[k].factor;
+			const bool first = ptr_[j] == k;
+			switch (rule) {
+				case CombinationRule::LINEAR:
+					if (first) { dst = src;} else { dst += src;}
+					break;
+				case CombinationRule::SRSS:
+					if (first) { dst = src.square();} else { dst += src.square();}
+					break;
+				case CombinationRule::ABS:
+					if (first) { dst = src.abs();} else { dst += src.abs();}
+					break;
+				case CombinationRule::MAX:
+					if (first) { dst = src;} else { dst = dst.max(src);}
+					break;
+				case CombinationRule::MIN:
+					if (first) { dst = src;} else { dst = dst.min(src);}
+					break;
+			}
+		}
+		if (CombinationRule::SRSS == rule) dst = dst.sqrt();
+	}
+}
+
+/**
+ *  \brief Combine results of load cases.
+ *  \param[in] basis results of load cases, one column per case and rows of
+ *  any items stacked, such as nodal displacements or element forces.
+ *  \return results of combinations, one column per combination.
+ */
+template <class T>
+matrix_<T> LoadCombination<T>::combine(const Eigen::Ref<const matrix_<T>> &basis) const {
+	assert(basis.cols() == num_case_);
+	const Eigen::Index m = basis.rows(), nc = num_case_, nb = get_num_combination();
+	const Eigen::Index blk{256};
+	matrix_<T> res(m, nb);
+	#pragma omp parallel for schedule(static)
+	for (Eigen::Index r0 = 0; r0 < m; r0 += blk) {
+		const auto nr = std::min(blk, m-r0);
+		matrix_<T> val(nr, nc+nb);
+		val.leftCols(nc) = basis.middleRows(r0, nr);
+		this->evaluate(val);
+		res.middleRows(r0, nr) = val.rightCols(nb);
+	}
+	return res;
+}
+}  // namespace cafea
@@ -0,0 +1,55 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "cafea/base/nodal_scatter.hpp"
+
+namespace cafea {
+/**
+ *  \brief Build node-to-element map.
+ *  \param[in] elem_node node lists of elements, only nodes carrying results.
+ *
+ *  Shares of each node keep the order of elements, so the last share is
+ *  the element written last by a serial loop over elements.
+ */
+void NodalScatter::init(const std::vector<std::vector<int>> &elem_node) {
+	this->clear();
+	num_elem_ = elem_node.size();
+	for (const auto &it: elem_node) node_.insert(node_.end(), it.begin(), it.end());
+	std::sort(node_.begin(), node_.end());
+	node_.erase(std::unique(node_.begin(), node_.end()), node_.end());
+	// Counting sort of shares by node.
+	ptr_.assign(node_.size()+1, 0);
+	std::vector<size_t> loc;
+	for (const auto &it: elem_node) {
+		for (auto id: it) {
+			loc.push_back(static_cast<size_t>(this->find(id)));
+			ptr_[loc.back()+1]++;
+		}
+	}
+	for (size_t i = 0; i < node_.size(); i++) ptr_[i+1] += ptr_[i];
+	share_.resize(ptr_.back());
+	std::vector<size_t> cur(ptr_.begin(), ptr_.end()-1);
+	size_t k{0};
+	for (size_t e = 0; e < elem_node.size(); e++) {
+		for (size_t j = 0; j < elem_node[e].size(); j++) {
+			share_[cur[loc[k++]]++] = Share{e, static_cast<int>(j)};
+		}
+	}
+}
+
+/**
+ *  \brief Get index of node.
+ *  \param[in] id node id.
+ *  \return index of node, -1 when not found.
+ */
+int NodalScatter::find(int id) const {
+	auto got = std::lower_bound(node_.begin(), node_.end(), id);
+	if (got == node_.end() || *got != id) return -1;
+	return static_cast<int>(std::distance(node_.begin(), got));
+}
+}  // namespace cafea
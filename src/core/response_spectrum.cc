@@ -0,0 +1,193 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+#include <numeric>
+
+#include "fmt/format.h"
+
+#include "cafea/base/response_spectrum.hpp"
+
+namespace cafea {
+/**
+ *  \brief Load modal results.
+ *  \param[in] shape mode shape, one column per mode.
+ *  \param[in] freq natural frequency in Hz.
+ *  \param[in] mass global mass matrix.
+ *  \param[in] influence influence vectors, one column per direction.
+ *  \param[in] is_normalized mode shape is mass normalized.
+ *
+ *  Mass matrix multiplies influence vectors once per direction, and mode
+ *  shapes are multiplied only when they are not mass normalized.
+ */
+template <class T>
+void ResponseSpectrum<T>::load(const matrix_<T> &shape, const vecX_<T> &freq, const Eigen::SparseMatrix<T> &mass,
+	const matrix_<T> &influence, bool is_normalized) {
+	this->clear();
+	assert(shape.cols() == freq.size());
+	assert(shape.rows() == mass.rows() && shape.rows() == influence.rows());
+	freq_ = freq;
+	matrix_<T> mr = mass*influence;
+	if (is_normalized) {
+		mgen_ = vecX_<T>::Ones(freq.size());
+	} else {
+		matrix_<T> mp = mass*shape;
+		mgen_ = shape.cwiseProduct(mp).colwise().sum().transpose();
+	}
+	gamma_ = shape.transpose()*mr;
+	for (Eigen::Index i = 0; i < gamma_.rows(); i++) {
+		gamma_.row(i) /= mgen_(i) > EPS<T>() ? mgen_(i): T(1);
+	}
+	meff_ = gamma_.cwiseAbs2();
+	for (Eigen::Index i = 0; i < meff_.rows(); i++) meff_.row(i) *= mgen_(i);
+	mtot_ = influence.cwiseProduct(mr).colwise().sum().transpose();
+	this->init_correlation();
+}
+
+/**
+ *  \brief Set acceleration spectrum.
+ *  \param[in] dir index of direction.
+ *  \param[in] freq frequency in Hz.
+ *  \param[in] accel spectral acceleration.
+ */
+template <class T>
+void ResponseSpectrum<T>::set_spectrum(size_t dir, const vecX_<T> &freq, const vecX_<T> &accel) {
+	assert(freq.size() == accel.size());
+	if (spec_.size() <= dir) spec_.resize(dir+1);
+	std::vector<Eigen::Index> order(freq.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&freq] (auto a, auto b) { return freq(a) < freq(b);});
+	auto &p = spec_[dir];
+	p.first.resize(freq.size());
+	p.second.resize(freq.size());
+	for (size_t i = 0; i < order.size(); i++) {
+		p.first(i) = freq(order[i]);
+		p.second(i) = accel(order[i]);
+	}
+}
+
+/**
+ *  \brief Set modal damping ratio.
+ */
+template <class T>
+void ResponseSpectrum<T>::set_damping(T zeta) {
+	zeta_ = std::max(T(0), zeta);
+	this->init_correlation();
+}
+
+/**
+ *  \brief Set modal combination method.
+ */
+template <class T>
+void ResponseSpectrum<T>::set_method(ModeCombination method) {
+	method_ = method;
+	this->init_correlation();
+}
+
+/**
+ *  \brief Spectral acceleration by linear interpolation.
+ *  \param[in] dir index of direction.
+ *  \param[in] freq frequency in Hz.
+ *  \return zero when spectrum of direction is empty.
+ */
+template <class T>
+T ResponseSpectrum<T>::get_accel(size_t dir, T freq) const {
+	if (spec_.size() <= dir || 1 > spec_[dir].first.size()) return T(0);
+	const auto &f = spec_[dir].first;
+	const auto &a = spec_[dir].second;
+	const auto n = f.size();
+	if (freq <= f(0)) return a(0);
+	if (freq >= f(n-1)) return a(n-1);
+	auto k = std::distance(f.data(), std::upper_bound(f.data(), f.data()+n, freq));
+	T s = (freq-f(k-1))/(f(k)-f(k-1));
+	return (T(1)-s)*a(k-1)+s*a(k);
+}
+
+/**
+ *  \brief Modal coordinates.
+ *  \return coordinates of modes in rows and directions in columns.
+ *
+ *  Rigid body modes with zero frequency are ignored.
+ */
+template <class T>
+matrix_<T> ResponseSpectrum<T>::get_modal_coord() const {
+	matrix_<T> q = matrix_<T>::Zero(gamma_.rows(), gamma_.cols());
+	for (Eigen::Index i = 0; i < q.rows(); i++) {
+		if (EPS<T>() >= freq_(i)) continue;
+		T w2 = T(4)*PI<T>()*PI<T>()*freq_(i)*freq_(i);
+		for (Eigen::Index j = 0; j < q.cols(); j++) q(i, j) = gamma_(i, j)*get_accel(j, freq_(i))/w2;
+	}
+	return q;
+}
+
+/**
+ *  \brief Combine modal response.
+ *  \param[in] resp response of unit modal coordinates, outputs in rows and modes in columns.
+ *  \return peak response, outputs in rows and directions in columns.
+ *
+ *  Rows are split into blocks for threads, and each block is combined by
+ *  one matrix product with correlation matrix.
+ */
+template <class T>
+matrix_<T> ResponseSpectrum<T>::combine(const matrix_<T> &resp) const {
+	assert(static_cast<size_t>(resp.cols()) == get_num_mode());
+	const matrix_<T> q = this->get_modal_coord();
+	const Eigen::Index num_row = resp.rows(), num_dir = q.cols(), blk = 256;
+	const int num_blk = static_cast<int>((num_row+blk-1)/blk);
+	matrix_<T> res = matrix_<T>::Zero(num_row, num_dir);
+	#pragma omp parallel for schedule(static)
+	for (int b = 0; b < num_blk; b++) {
+		const Eigen::Index r0 = b*blk, nr = std::min(blk, num_row-r0);
+		for (Eigen::Index d = 0; d < num_dir; d++) {
+			matrix_<T> x = resp.middleRows(r0, nr)*q.col(d).asDiagonal();
+			if (ModeCombination::SRSS == method_) {
+				res.block(r0, d, nr, 1) = x.rowwise().norm();
+				continue;
+			}
+			if (ModeCombination::GROUPING == method_) x = x.cwiseAbs();
+			matrix_<T> y = x*rho_;
+			res.block(r0, d, nr, 1) = x.cwiseProduct(y).rowwise().sum().cwiseMax(T(0)).cwiseSqrt();
+		}
+	}
+	return res;
+}
+
+/**
+ *  \brief Update modal correlation matrix.
+ *
+ *  CQC follows Der Kiureghian with constant damping ratio,
+ *  \f[ \rho_{ij}=\frac{8\zeta^2(1+r)r^{3/2}}{(1-r^2)^2+4\zeta^2r(1+r)^2} \f]
+ *  Grouping combines absolute values of modes whose frequencies are within
+ *  ten percent of the lowest frequency in group.
+ */
+template <class T>
+void ResponseSpectrum<T>::init_correlation() {
+	const Eigen::Index n = freq_.size();
+	rho_ = matrix_<T>::Identity(n, n);
+	switch (method_) {
+		case ModeCombination::CQC:
+			for (Eigen::Index i = 0; i < n; i++) {
+				for (Eigen::Index j = i+1; j < n; j++) {
+					if (EPS<T>() >= freq_(i) || EPS<T>() >= freq_(j)) continue;
+					T r = freq_(j)/freq_(i), z2 = zeta_*zeta_;
+					T den = (T(1)-r*r)*(T(1)-r*r)+T(4)*z2*r*(T(1)+r)*(T(1)+r);
+					rho_(i, j) = rho_(j, i) = EPS<T>() < den ? T(8)*z2*(T(1)+r)*pow(r, T(1.5))/den: T(1);
+				}
+			}
+			break;
+		case ModeCombination::GROUPING:
+			for (Eigen::Index i = 0; i < n;) {
+				Eigen::Index j = i+1;
+				while (j < n && freq_(j) <= T(1.1)*freq_(i)) j++;
+				rho_.block(i, i, j-i, j-i).setOnes();
+				i = j;
+			}
+			break;
+		case ModeCombination::SRSS:
+		default: break;
+	}
+}
+}  // namespace cafea
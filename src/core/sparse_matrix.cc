@@ -69,7 +69,11 @@ void SparseMat<T>::unique(SpFmt sf) {
 	this->row_col_.erase(extr, this->row_col_.end());
 	this->nnz_ = this->row_col_.size();
 	this->stif_.resize(this->nnz_, T(.0));
-	this->mass_.resize(this->nnz_, T(.0));
+	if (this->with_mass_) {
+		this->mass_.resize(this->nnz_, T(.0));
+	} else {
+		std::vector<T>().swap(this->mass_);
+	}
 
 	size_t iter{0};
 	this->aux_.push_back(iter++);
@@ -88,13 +92,11 @@ void SparseMat<T>::unique(SpFmt sf) {
 	this->rhs_.resize(this->dim_, T(.0));
 }
 /**
- *  \brief Add stiffness and mass data.
+ *  \brief Position of index pair in values.
  *  \param[in] it index pair of row and column.
- *  \param[in] val_k value of stiffness.
- *  \param[in] val_m value of mass.
  */
 template <class T>
-void SparseMat<T>::add_matrix_data(SparseCell it, T val_k, T val_m) {
+size_t SparseMat<T>::find_index(SparseCell it) const {
 	std::array<size_t, 2> index_range;
 	if (this->get_format() == SpFmt::CSR) {
 		index_range[0] = this->aux_[it.row];
@@ -105,7 +107,18 @@ void SparseMat<T>::add_matrix_data(SparseCell it, T val_k, T val_m) {
 	}
 	auto got = std::find(this->row_col_.begin()+index_range[0],
 		this->row_col_.begin()+index_range[1], it);
-	auto nn = std::distance(this->row_col_.begin(), got);
+	return std::distance(this->row_col_.begin(), got);
+}
+/**
+ *  \brief Add stiffness and mass data.
+ *  \param[in] it index pair of row and column.
+ *  \param[in] val_k value of stiffness.
+ *  \param[in] val_m value of mass.
+ */
+template <class T>
+void SparseMat<T>::add_matrix_data(SparseCell it, T val_k, T val_m) {
+	assert(this->with_mass_);
+	auto nn = this->find_index(it);
 	this->stif_[nn] += val_k;
 	this->mass_[nn] += val_m;
 }
@@ -126,7 +139,7 @@ void SparseMat<T>::add_matrix_data_KM(SparseCell it, T val_k, T val_m) {
  */
 template <class T>
 void SparseMat<T>::add_matrix_data_K(SparseCell it, T val_k) {
-	this->add_matrix_data(it, val_k, T(0));
+	this->stif_[this->find_index(it)] += val_k;
 }
 /**
  *  \brief Add stiffness and mass data.
@@ -0,0 +1,130 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/base/time_integrator.hpp"
+
+namespace cafea {
+/**
+ *  \brief Load stiffness and mass matrix.
+ *  \param[in] stif global stiffness matrix.
+ *  \param[in] mass global mass matrix.
+ *  \param[in] a0 Rayleigh damping coefficient of mass.
+ *  \param[in] a1 Rayleigh damping coefficient of stiffness.
+ */
+template <class T, class U>
+void TimeIntegrator<T, U>::load(const Eigen::SparseMatrix<T> &stif, const Eigen::SparseMatrix<T> &mass, T a0, T a1) {
+	this->clear();
+	assert(stif.rows() == stif.cols());
+	assert(stif.rows() == mass.rows() && stif.cols() == mass.cols());
+	K_ = stif;
+	M_ = mass;
+	C_ = a0*mass+a1*stif;
+	K_.makeCompressed();
+	M_.makeCompressed();
+	C_.makeCompressed();
+}
+
+/**
+ *  \brief Set HHT-alpha parameter.
+ *  \param[in] alpha numerical dissipation, 0 means trapezoidal rule.
+ */
+template <class T, class U>
+void TimeIntegrator<T, U>::set_hht_alpha(T alpha) {
+	alpha_ = std::min(T(0), std::max(T(-1)/T(3), alpha));
+	beta_ = (T(1)-alpha_)*(T(1)-alpha_)/T(4);
+	gamma_ = T(0.5)-alpha_;
+	isFactorized_ = false;
+}
+
+/**
+ *  \brief Set Newmark parameters.
+ *  \param[in] beta Newmark beta.
+ *  \param[in] gamma Newmark gamma.
+ */
+template <class T, class U>
+void TimeIntegrator<T, U>::set_newmark(T beta, T gamma) {
+	assert(T(0) < beta);
+	alpha_ = T(0);
+	beta_ = beta;
+	gamma_ = gamma;
+	isFactorized_ = false;
+}
+
+/**
+ *  \brief Set initial state.
+ *  \param[in] u0 initial displacement.
+ *  \param[in] v0 initial velocity.
+ *  \param[in] f0 initial load.
+ *  \param[in] t0 initial time.
+ *  \return false when mass matrix is singular and initial acceleration is zero.
+ */
+template <class T, class U>
+bool TimeIntegrator<T, U>::init(const vecX_<T> &u0, const vecX_<T> &v0, const vecX_<T> &f0, T t0) {
+	assert(u0.size() == K_.rows() && v0.size() == K_.rows() && f0.size() == K_.rows());
+	u_ = u0;
+	v_ = v0;
+	f_ = f0;
+	time_ = t0;
+	num_step_ = 0;
+	Eigen::SimplicialLDLT<Eigen::SparseMatrix<T>> solver_mass(M_);
+	if (solver_mass.info() != Eigen::ComputationInfo::Success) {
+		fmt::print("Singular mass matrix, initial acceleration is zero.\n");
+		a_ = vecX_<T>::Zero(u0.size());
+		return false;
+	}
+	vecX_<T> res = f0-C_*v0-K_*u0;
+	a_ = solver_mass.solve(res);
+	return true;
+}
+
+/**
+ *  \brief Factorize effective stiffness.
+ *  \param[in] dt time step.
+ */
+template <class T, class U>
+bool TimeIntegrator<T, U>::factorize(T dt) {
+	assert(T(0) < dt);
+	const T c0 = T(1)/(beta_*dt*dt), c1 = (T(1)+alpha_)*gamma_/(beta_*dt);
+	Keff_ = c0*M_+c1*C_+(T(1)+alpha_)*K_;
+	if (0 == num_fact_) solver_.analyzePattern(Keff_);
+	solver_.factorize(Keff_);
+	num_fact_++;
+	dt_ = dt;
+	isFactorized_ = solver_.info() == Eigen::ComputationInfo::Success;
+	if (!isFactorized_) fmt::print("Decomposition Failed with time step: {}\n", dt);
+	return isFactorized_;
+}
+
+/**
+ *  \brief Advance one time step.
+ *  \param[in] dt time step.
+ *  \param[in] f_next load at the end of step.
+ *  \return false when effective stiffness is singular.
+ */
+template <class T, class U>
+bool TimeIntegrator<T, U>::step(T dt, const vecX_<T> &f_next) {
+	if ((!isFactorized_ || dt != dt_) && !factorize(dt)) return false;
+	const T c0 = T(1)/(beta_*dt*dt), c2 = T(1)/(beta_*dt), c3 = T(0.5)/beta_-T(1);
+	const T c4 = gamma_/(beta_*dt), c5 = T(1)-gamma_/beta_, c6 = dt*(T(1)-T(0.5)*gamma_/beta_);
+	vecX_<T> rhs = (T(1)+alpha_)*f_next-alpha_*f_;
+	rhs += M_*(c0*u_+c2*v_+c3*a_);
+	rhs += C_*((T(1)+alpha_)*(c4*u_-c5*v_-c6*a_)+alpha_*v_);
+	if (T(0) != alpha_) rhs += alpha_*(K_*u_);
+	vecX_<T> u_next = solver_.solve(rhs);
+	vecX_<T> a_next = c0*(u_next-u_-dt*v_)-c3*a_;
+	v_ += dt*((T(1)-gamma_)*a_+gamma_*a_next);
+	u_ = std::move(u_next);
+	a_ = std::move(a_next);
+	f_ = f_next;
+	time_ += dt;
+	num_step_++;
+	return true;
+}
+}  // namespace cafea
@@ -41,12 +41,25 @@ elem_out_5<U> StructuralElement<T, U>::combin14(const std::vector<Node<T, U>> pt
 template <class T, class U>
 elem_out_5<U> StructuralElement<T, U>::mass21(const NodeBase<T> *p, const Material<T> *prop,
 											  const Section<T> *sect, const int opt[]) {
-	matrix_<U> stif = matrix_<U>::Zero(6, 6);
-	matrix_<U> mass = matrix_<U>::Zero(6, 6);
-	matrix_<U> tran = matrix_<U>::Identity(6, 6);
-	vecX_<U>   rhs  = vecX_<U>::Zero(6);
-	std::map<std::string, U> attr{{"Length", U(0)}, {"Area", U(0)}, {"Volume", U(0)},
-		{"Mass", sect->get_sect_prop(SectionProp::ADDONMASS)}};
+	elem_kernel_<U, ElementType::MASS21> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::mass21(p, prop, sect, opt, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *  \brief Mass in fixed-size matrix.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::mass21(const NodeBase<T> *p, const Material<T> *prop, const Section<T> *sect,
+									 const int opt[], elem_kernel_<U, ElementType::MASS21> &ke,
+									 ElementProperty<U> &attr) {
+	ke.stif.setZero();
+	ke.mass.setZero();
+	ke.tran.setIdentity();
+	ke.rhs.setZero();
+	auto &mass = ke.mass;
+	attr.assign({{ElementProp::LENGTH, U(0)}, {ElementProp::AREA, U(0)}, {ElementProp::VOLUME, U(0)},
+		{ElementProp::MASS, sect->get_sect_prop(SectionProp::ADDONMASS)}});
 
 	//! Mass on X Y Z direction.
 	//! Notice: mass element do not need transform in most cases.
@@ -62,7 +75,6 @@ elem_out_5<U> StructuralElement<T, U>::mass21(const NodeBase<T> *p, const Materi
 		}
 	}
 	// fmt::print("Mass add-on:{}\n", mass(0, 0));
-	return std::make_tuple(stif, mass, tran, rhs, attr);
 }
 
 /**
@@ -72,16 +84,29 @@ template <class T, class U>
 elem_out_5<U> StructuralElement<T, U>::combin14(const NodeBase<T> *p1, const NodeBase<T> *p2,
 											    const Material<T> *prop, const Section<T> *sect,
 												const int opt[]) {
-	matrix_<U> stif    = matrix_<U>::Zero(12, 12);
-	matrix_<U> mass    = matrix_<U>::Zero(12, 12);
-	matrix_<U> loc2gbl = matrix_<U>::Identity(12, 12);
-	vecX_<U>   rhs     = vecX_<U>::Zero(12);
-	std::map<std::string, U> attr{{"Length", U(0)}, {"Area", U(0)}, {"Volume", U(0)}};
+	elem_kernel_<U, ElementType::COMBIN14> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::combin14(p1, p2, prop, sect, opt, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *  \brief Spring in fixed-size matrix.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::combin14(const NodeBase<T> *p1, const NodeBase<T> *p2, const Material<T> *prop,
+									   const Section<T> *sect, const int opt[],
+									   elem_kernel_<U, ElementType::COMBIN14> &ke, ElementProperty<U> &attr) {
+	auto &stif    = ke.stif;
+	auto &loc2gbl = ke.tran;
+	stif.setZero();
+	ke.mass.setZero();
+	loc2gbl.setIdentity();
+	ke.rhs.setZero();
+	attr.assign({{ElementProp::LENGTH, U(0)}, {ElementProp::AREA, U(0)}, {ElementProp::VOLUME, U(0)}});
 
 	Eigen::Matrix<T, 3, 3> euler_tran;
-	U l;
-	matrix_<U> tt = matrix_<U>::Zero(3, 3);
-	std::tie(l, tt) = NodeFunc<T, U>::coord_tran(p1, p2);
+	mat3_<U> tt;
+	NodeFunc<T, U>::coord_tran(p1, p2, tt);
 
 	if (opt[1] == 0) {
 		for (int i: {0, 1, 2, 3}) loc2gbl.block(i*3, i*3, 3, 3) = tt;
@@ -115,7 +140,5 @@ elem_out_5<U> StructuralElement<T, U>::combin14(const NodeBase<T> *p1, const Nod
 		stif(m+6, m) = stif(m, m+6) = -stif(m, m);
 		// fmt::print("Dof:{}\tKe:{}\n", m+1, stif(m, m));
 	}
-
-	return std::make_tuple(stif, mass, loc2gbl, rhs, attr);
 }
 }  // namespace cafea
@@ -0,0 +1,164 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cassert>
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/element/code_check.hpp"
+
+namespace cafea {
+/**
+ *  \brief Reserve number of elements.
+ */
+template <class T>
+void PipeCodeCheck<T>::reserve(size_t n) {
+	for (auto &it: in_) it.reserve(n);
+	id_.reserve(n);
+}
+
+/**
+ *  \brief Append an element.
+ *  \param [in] id element id.
+ *  \param [in] attr attribute of pipe, with OD, IY, THICK, SIF and PRESIN.
+ *  \param [in] sh allowable stress at hot condition.
+ *  \param [in] sc allowable stress at cold condition.
+ */
+template <class T>
+void PipeCodeCheck<T>::add(int id, const ElementProperty<T> &attr, T sh, T sc) {
+	const T Dout = attr.get(ElementProp::OD, EPS<T>());
+	const T tn = attr.get(ElementProp::THICK, EPS<T>());
+	const T val[NUM_IN] = {T(2)*attr.get(ElementProp::IY, EPS<T>())/Dout, attr.get(ElementProp::SIF, T(1)),
+		attr.get(ElementProp::PRESIN)*Dout/(T(4)*tn), sh, sc};
+	for (int i = 0; i < NUM_IN; i++) in_[i].push_back(val[i]);
+	id_.push_back(id);
+}
+
+/**
+ *  \brief Add check.
+ *  \param [in] type stress case.
+ *  \param [in] comb combination of loads, occasional loads for OCCASIONAL.
+ *  \param [in] sustained sustained combination, required by OCCASIONAL.
+ *  \return index of check.
+ */
+template <class T>
+int PipeCodeCheck<T>::add_check(PipeCodeCase type, int comb, int sustained) {
+	assert(0 <= comb);
+	assert(PipeCodeCase::OCCASIONAL != type || 0 <= sustained);
+	check_.push_back(Check{type, comb, sustained});
+	return get_num_check()-1;
+}
+
+/**
+ *  \brief Reset moments of combinations.
+ */
+template <class T>
+void PipeCodeCheck<T>::init_moment(int num_comb) {
+	for (const auto &it: check_) assert(it.comb < num_comb && it.sustained < num_comb);
+	mom_ = matrix_<T>::Zero(id_.size(), num_comb);
+}
+
+/**
+ *  \brief Set moments of element.
+ *  \param [in] i index of element.
+ *  \param [in] force member force in rows 0-5 at node I and J of each
+ *  combination, such as pipe_combine() with member force requested.
+ *
+ *  Elements are independent, so threads may set different elements.
+ */
+template <class T>
+void PipeCodeCheck<T>::set_moment(size_t i, const Eigen::Ref<const matrix_<T>> &force) {
+	assert(i < id_.size() && 6 <= force.rows() && force.cols() == 2*mom_.cols());
+	const Eigen::Matrix<T, 1, Eigen::Dynamic> m = force.middleRows(3, 3).colwise().norm();
+	for (Eigen::Index c = 0; c < mom_.cols(); c++) mom_(i, c) = std::max(m(2*c), m(2*c+1));
+}
+
+/**
+ *  \brief Evaluate all checks.
+ */
+template <class T>
+void PipeCodeCheck<T>::evaluate() {
+	using arr_ = Eigen::Array<T, Eigen::Dynamic, 1>;
+	using cmap_ = Eigen::Map<const arr_>;
+	const auto n = static_cast<Eigen::Index>(id_.size());
+	const cmap_ zs(in_[ZS].data(), n), sif(in_[SIF].data(), n), pl(in_[PL].data(), n);
+	const cmap_ sh(in_[SH].data(), n), sc(in_[SC].data(), n);
+	const arr_ i75 = (T(0.75)*sif).max(T(1))/zs;
+	stress_.resize(n, get_num_check());
+	allow_.resize(n, get_num_check());
+	#pragma omp parallel for schedule(static)
+	for (int j = 0; j < get_num_check(); j++) {
+		const auto &chk = check_[j];
+		const auto mc = mom_.col(chk.comb).array();
+		auto s = stress_.col(j).array();
+		auto a = allow_.col(j).array();
+		switch (chk.type) {
+			case PipeCodeCase::SUSTAINED:
+				s = pl + i75*mc;
+				a = sh;
+				break;
+			case PipeCodeCase::OCCASIONAL:
+				s = pl + i75*(mom_.col(chk.sustained).array() + mc);
+				a = k_*sh;
+				break;
+			case PipeCodeCase::EXPANSION:
+				s = sif*mc/zs;
+				a = f_*(T(1.25)*sc + T(0.25)*sh);
+				if (0 <= chk.sustained) a += f_*(sh - pl - i75*mom_.col(chk.sustained).array()).max(T(0));
+				break;
+		}
+	}
+}
+
+/**
+ *  \brief All checks of element pass or not.
+ */
+template <class T>
+bool PipeCodeCheck<T>::is_pass(size_t i) const {
+	const auto r = static_cast<Eigen::Index>(i);
+	return (stress_.row(r).array() <= allow_.row(r).array()).all();
+}
+
+/**
+ *  \brief Number of elements failed in check.
+ */
+template <class T>
+size_t PipeCodeCheck<T>::get_num_fail(int j) const {
+	return static_cast<size_t>((stress_.col(j).array() > allow_.col(j).array()).count());
+}
+
+/**
+ *  \brief Maximum ratio of check.
+ *  \param [in] j index of check.
+ *  \param [out] elem index of element with maximum ratio.
+ */
+template <class T>
+T PipeCodeCheck<T>::get_max_ratio(int j, size_t *elem) const {
+	if (1 > stress_.rows()) return T(0);
+	Eigen::Index k;
+	const T res = (stress_.col(j).array()/allow_.col(j).array()).maxCoeff(&k);
+	if (nullptr != elem) *elem = static_cast<size_t>(k);
+	return res;
+}
+
+/**
+ *  \brief Print utilization of checks.
+ */
+template <class T>
+void PipeCodeCheck<T>::print_summary() const {
+	const char *name[] = {"Sustained", "Occasional", "Expansion"};
+	fmt::print("{:>5s} {:<10s} {:>5s} {:>8s} {:>8s} {:>6s} {:>6s}\n", "Check", "Case", "Comb", "Ratio",
+		"Element", "Fail", "Status");
+	for (int j = 0; j < get_num_check(); j++) {
+		size_t k{0};
+		const T r = get_max_ratio(j, &k);
+		const size_t nf = get_num_fail(j);
+		fmt::print("{:>5d} {:<10s} {:>5d} {:>8.3f} {:>8d} {:>6d} {:>6s}\n", j, name[static_cast<int>(check_[j].type)],
+			check_[j].comb, r, 0 < size() ? id_[k]: 0, nf, 0 == nf ? "PASS": "FAIL");
+	}
+}
+}  // namespace cafea
@@ -38,35 +38,50 @@ size_t Element<T>::get_element_order() const {
  */
 template <class T>
 void Element<T>::post_stress(const vecX_<T> x) {
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-		case ElementType::PIPE18:
-		// fmt::print("Not yet finish stress result.\n");
-			fmt::print("Element ID: {}\n", this->get_id());
-			this->result_ = StructuralElementPost<T>::pipe(this->stif_, this->tran_, x, this->rhs_, this->attr_);
-			break;
-		case ElementType::MASS21:
-		case ElementType::COMBIN14:
+	bool found = registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_stress) {
+			this->result_ = traits_::template stress<T>(this->stif_, this->tran_, x, this->rhs_, this->attr_,
+				false, T(0), T(0), this->result_req_);
+		} else if constexpr (traits_::has_kernel) {
 			fmt::print("No stress equation for spring and mass element.\n");
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
-	}
+		} else {
+			fmt::print("Unsupported element type\n");
+		}
+	});
+	if (!found) fmt::print("Unsupported element type\n");
+}
+/**
+ *  \brief Member force of element.
+ *  \param[in] x element displacement, one column per mode or load case.
+ *  \return member force with same columns as x, empty for unsupported element.
+ */
+template <class T>
+matrix_<T> Element<T>::get_member_force(const matrix_<T> x) const {
+	matrix_<T> res;
+	registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_stress) res = traits_::template member_force<T>(this->stif_, this->tran_, x, this->attr_);
+	});
+	return res;
+}
+/**
+ *  \brief Post process with peak member force.
+ *  \param[in] force member force at node I and J in columns.
+ *
+ *  Stresses are evaluated from combined member force without pressure.
+ */
+template <class T>
+void Element<T>::post_stress_peak(const matrix_<T> force) {
+	registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_stress) {
+			assert(6 == force.rows() && 2 == force.cols());
+			this->result_ = matrix_<T>::Zero(99, 2);
+			this->result_.topRows(6) = force;
+			traits_::template force_stress<T>(this->result_, this->attr_, true);
+		}
+	});
 }
 /**
  *  \brief Get shape of element matrix.
@@ -109,36 +124,11 @@ size_t Element<T>::get_element_type_id() const {
 	return ElementAttr::get_element_type_id(this->etype_);
 }
 /**
- *
+ *  \brief Set type of element.
+ *  \param[in] x id of element type in Ansys rules.
  */
 template <class T>
 void Element<T>::set_element_type(int x) {
-	switch (x) {
-		case 14:
-			this->etype_ = ElementType::COMBIN14;
-			break;
-		case 16:
-			this->etype_ = ElementType::PIPE16;
-			break;
-		case 18:
-			this->etype_ = ElementType::PIPE18;
-			break;
-		case 21:
-			this->etype_ = ElementType::MASS21;
-			break;
-		case 181:
-			this->etype_ = ElementType::SHELL181;
-			break;
-		case 185:
-			this->etype_ = ElementType::SOLID185;
-			break;
-		case 186:
-			this->etype_ = ElementType::SOLID186;
-			break;
-		case 281:
-			this->etype_ = ElementType::SHELL281;
-			break;
-		default: this->etype_ = ElementType::UNKNOWN;
-	}
+	this->etype_ = 0 < x ? ElementAttr::get_element_type(static_cast<size_t>(x)): ElementType::UNKNOWN;
 }
 }  // namespace cafea
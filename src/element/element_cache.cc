@@ -0,0 +1,195 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/element/element_cache.hpp"
+
+namespace cafea {
+namespace {
+constexpr char cache_magic[8] = {'C', 'A', 'F', 'E', 'A', 'E', 'M', 'C'};//!< Magic of cache file.
+constexpr uint32_t cache_version{1};//!< Version of cache file.
+//! Mix value into hash.
+inline void hash_combine(uint64_t &seed, uint64_t val) {
+	seed ^= val + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+//! Write raw data.
+template <class V>
+inline void write_raw(std::ofstream &fout, const V *val, size_t n = 1) {
+	fout.write(reinterpret_cast<const char*>(val), sizeof(V)*n);
+}
+//! Read raw data.
+template <class V>
+inline bool read_raw(std::ifstream &fin, V *val, size_t n = 1) {
+	return static_cast<bool>(fin.read(reinterpret_cast<char*>(val), sizeof(V)*n));
+}
+}
+
+/**
+ *  \brief Hash of key.
+ */
+template <class T>
+size_t ElementCache<T>::KeyHash::operator()(const Key &a) const {
+	uint64_t seed = static_cast<uint64_t>(static_cast<int64_t>(a.etype_));
+	hash_combine(seed, static_cast<uint64_t>(static_cast<int64_t>(a.matl_)));
+	hash_combine(seed, static_cast<uint64_t>(static_cast<int64_t>(a.sect_)));
+	for (auto x: a.keyopt_) hash_combine(seed, static_cast<uint64_t>(static_cast<int64_t>(x)));
+	hash_combine(seed, static_cast<uint64_t>(a.geom_));
+	return static_cast<size_t>(seed);
+}
+
+/**
+ *  \brief Key of element.
+ *  \param [in] et type of element.
+ *  \param [in] matl material id.
+ *  \param [in] sect section id.
+ *  \param [in] opt options of element.
+ *  \param [in] geom length of straight pipe or chord of elbow.
+ */
+template <class T>
+typename ElementCache<T>::Key ElementCache<T>::make_key(ElementType et, int matl, int sect,
+	const std::array<int, 10> &opt, T geom) const {
+	Key res;
+	res.etype_ = et;
+	res.matl_ = matl;
+	res.sect_ = sect;
+	res.keyopt_ = opt;
+	res.geom_ = static_cast<int64_t>(std::llround(geom/tol_));
+	return res;
+}
+
+/**
+ *  \brief Find entry.
+ *  \return pointer of entry, nullptr when key is missed.
+ */
+template <class T>
+const typename ElementCache<T>::Entry* ElementCache<T>::find(const Key &key) {
+	auto got = dict_.find(key);
+	if (got == dict_.end()) {
+		num_miss_++;
+		return nullptr;
+	}
+	num_hit_++;
+	return &(got->second);
+}
+
+/**
+ *  \brief Insert entry.
+ *  \return pointer of entry in cache, it is valid until cache is cleared.
+ */
+template <class T>
+const typename ElementCache<T>::Entry* ElementCache<T>::insert(const Key &key, const Entry &val) {
+	return &(dict_.emplace(key, val).first->second);
+}
+
+/**
+ *  \brief Save entries to binary file.
+ *  \param [in] fn file name.
+ *
+ *  File starts with magic, version, size of scalar, tolerance and number of
+ *  entries, then keys and matrices of entries are stored in native layout.
+ */
+template <class T>
+bool ElementCache<T>::save(const std::string &fn) const {
+	std::ofstream fout(fn, std::ios::binary);
+	if (!fout) {
+		fmt::print("Cannot open element cache file: {}\n", fn);
+		return false;
+	}
+	const uint32_t head[2] = {cache_version, static_cast<uint32_t>(sizeof(T))};
+	const uint64_t num = dict_.size();
+	write_raw(fout, cache_magic, sizeof(cache_magic));
+	write_raw(fout, head, 2);
+	write_raw(fout, &tol_);
+	write_raw(fout, &num);
+	for (const auto &it: dict_) {
+		const auto &key = it.first;
+		const auto &val = it.second;
+		const int32_t id[3] = {static_cast<int32_t>(key.etype_), key.matl_, key.sect_};
+		write_raw(fout, id, 3);
+		write_raw(fout, key.keyopt_.data(), key.keyopt_.size());
+		write_raw(fout, &key.geom_);
+		write_raw(fout, val.stif.data(), val.stif.size());
+		write_raw(fout, val.mass.data(), val.mass.size());
+		write_raw(fout, val.rhs.data(), val.rhs.size());
+		uint32_t mask{0};
+		std::array<T, ElementProperty<T>::size()> attr;
+		for (size_t i = 0; i < attr.size(); i++) {
+			auto p = static_cast<ElementProp>(i);
+			attr[i] = val.attr.get(p);
+			if (val.attr.has(p)) mask |= uint32_t(1) << i;
+		}
+		write_raw(fout, &mask);
+		write_raw(fout, attr.data(), attr.size());
+	}
+	return static_cast<bool>(fout);
+}
+
+/**
+ *  \brief Load entries from binary file.
+ *  \param [in] fn file name.
+ *  \return false when file is missing or written by other version or scalar,
+ *  and the cache is unchanged.
+ *
+ *  Entries of file are merged into cache, and tolerance of file is used.
+ */
+template <class T>
+bool ElementCache<T>::load(const std::string &fn) {
+	std::ifstream fin(fn, std::ios::binary);
+	if (!fin) return false;
+	char magic[sizeof(cache_magic)];
+	uint32_t head[2];
+	T tol;
+	uint64_t num;
+	if (!read_raw(fin, magic, sizeof(magic)) || 0 != std::memcmp(magic, cache_magic, sizeof(cache_magic)) ||
+		!read_raw(fin, head, 2) || cache_version != head[0] || sizeof(T) != head[1] ||
+		!read_raw(fin, &tol) || !read_raw(fin, &num)) {
+		fmt::print("Incompatible element cache file: {}\n", fn);
+		return false;
+	}
+	std::unordered_map<Key, Entry, KeyHash> tmp;
+	tmp.reserve(static_cast<size_t>(std::min<uint64_t>(num, 1 << 16)));
+	for (uint64_t k = 0; k < num; k++) {
+		Key key;
+		Entry val;
+		int32_t id[3];
+		uint32_t mask;
+		std::array<T, ElementProperty<T>::size()> attr;
+		if (!read_raw(fin, id, 3) || !read_raw(fin, key.keyopt_.data(), key.keyopt_.size()) ||
+			!read_raw(fin, &key.geom_) || !read_raw(fin, val.stif.data(), val.stif.size()) ||
+			!read_raw(fin, val.mass.data(), val.mass.size()) || !read_raw(fin, val.rhs.data(), val.rhs.size()) ||
+			!read_raw(fin, &mask) || !read_raw(fin, attr.data(), attr.size())) {
+			fmt::print("Truncated element cache file: {}\n", fn);
+			return false;
+		}
+		key.etype_ = static_cast<ElementType>(id[0]);
+		key.matl_ = id[1];
+		key.sect_ = id[2];
+		for (size_t i = 0; i < attr.size(); i++) {
+			if (0 != (mask & (uint32_t(1) << i))) val.attr.set(static_cast<ElementProp>(i), attr[i]);
+		}
+		tmp.emplace(key, val);
+	}
+	if (tol != tol_) dict_.clear();
+	tol_ = tol;
+	dict_.merge(tmp);
+	return true;
+}
+
+/**
+ *  \brief Print statistics.
+ */
+template <class T>
+void ElementCache<T>::print_stats() const {
+	fmt::print("Element cache entries: {}\tHits: {}\tMisses: {}\tHit rate: {:.1f}%\tMemory: {:.1f} KB\n",
+		this->size(), num_hit_, num_miss_, 1.e2*this->get_hit_rate(), this->get_memory_size()/1024.0);
+}
+}  // namespace cafea
@@ -4,6 +4,12 @@
  *  All rights reserved.
  *  Distributed under GPL v3 license.
  */
+#include <array>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "cafea/base/block_tran.hpp"
 #include "cafea/element/element_lib.hpp"
 
 using Eigen::MatrixXd;
@@ -45,9 +51,27 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const std::vector<Node<T, U>> pt,
 template <class T, class U>
 elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeBase<T> *p2, const Material<T> *prop,
 											  const Section<T> *sect, const int *opt) {
-	matrix_<U> stif = matrix_<U>::Zero(12, 12);//! Stiffness matrix.
-	matrix_<U> mass = matrix_<U>::Zero(12, 12);//! Mass matrix.
-	vecX_<U>   rhs  = vecX_<U>::Zero(12);//! Right-hand side vector.
+	elem_kernel_<U, ElementType::PIPE16> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::pipe16(p1, p2, prop, sect, opt, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *  \brief Straight Pipe Element No.16 in fixed-size matrix.
+ *
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeBase<T> *p2, const Material<T> *prop,
+									 const Section<T> *sect, const int *opt, elem_kernel_<U, ElementType::PIPE16> &ke,
+									 ElementProperty<U> &attr) {
+	auto &stif = ke.stif;//! Stiffness matrix.
+	auto &mass = ke.mass;//! Mass matrix.
+	auto &rhs  = ke.rhs;//! Right-hand side vector.
+	stif.setZero();
+	mass.setZero();
+	rhs.setZero();
 
 	U Ro = 0.5*sect->get_sect_prop(SectionProp::OD);//! Outer radius.
 	decltype(Ro) Ri  = Ro - sect->get_sect_prop(SectionProp::TKWALL);//! Inner radius.
@@ -59,11 +83,11 @@ elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeB
 	decltype(Ro) ES  = prop->get_material_prop(MaterialProp::YOUNG)*Ax;
 	decltype(Ro) GJx = prop->get_material_prop(MaterialProp::YOUNG)*Jxx*0.5/(1. + v);
 	//! Coordinate transform.
-	decltype(Ro) Le;//! Lenght of pipe.
-	matrix_<U> tt    = matrix_<U>::Zero(3, 3);
-	std::tie(Le, tt) = NodeFunc<T, U>::coord_tran(p1, p2);
+	mat3_<U> tt;
+	decltype(Ro) Le = NodeFunc<T, U>::coord_tran(p1, p2, tt);//! Lenght of pipe.
 	//! Form transform matrix.
-	matrix_<U> loc2gbl = matrix_<U>::Zero(12, 12);
+	auto &loc2gbl = ke.tran;
+	loc2gbl.setZero();
 	for(int i: {0, 1, 2, 3})loc2gbl.block(i*3, i*3, 3, 3) = tt;
 	//! Axial.
 	stif(0, 0) = stif(6, 6) = ES/Le;
@@ -106,7 +130,9 @@ elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeB
 	decltype(Ro) ry = prop->get_material_prop(MaterialProp::DENS)*Iyy;
 
 	// Lumped Mass.
-	if (0 < opt[0]) {
+	if (!ke.want(EvalRequest::MASS)) {
+		// Mass is not requested.
+	} else if (0 < opt[0]) {
 		mass(0, 0) = mass(6, 6) = Me/2.;
 		mass(1, 1) = mass(7, 7) = Me/2.;
 		mass(2, 2) = mass(8, 8) = Me/2.;
@@ -142,7 +168,7 @@ elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeB
 		mass(10, 2) = mass(2, 10) = -mass(4, 8);
 		mass(10, 8) = mass(8, 10) = -mass(4, 2);
 	}
-    {
+	if (ke.want(EvalRequest::MASS)) {
 		decltype(Ro) fluid_dens = sect->get_sect_prop(SectionProp::DENSFL);
 		if (fluid_dens > EPS<>()) {
 			for (int i: {0, 1, 2, 6, 7, 8}) {
@@ -156,13 +182,21 @@ elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeB
 
 	decltype(Ro) SIF = U(1);//! Stress intensity factor.
 
-	std::map<std::string, U> attr{{"Length", Le}, {"Area", Ax}, {"Volume", Ax*Le}, {"Mass", Me},
-	 	{"Aw", Ax}, {"Thick", Ro-Ri}, {"OuterDiameter", U(2)*Ro}, {"InnerDiameter", U(2)*Ri},
-		{"Iy", Iyy}, {"Iz", Izz}, {"Jx", Jxx}, {"StressIntensificationFactor", SIF},
-		{"InternalPressure", sect->get_sect_prop(SectionProp::PRESIN)}, {"Angle", U(-1)},
-		{"CurvatureRadius", U(-1)}, };
-
-	return std::make_tuple(stif, mass, loc2gbl, rhs, attr);
+	if (!ke.want(EvalRequest::POST)) {
+		if (ke.want(EvalRequest::ATTR)) {
+			attr.assign({{ElementProp::LENGTH, Le}, {ElementProp::AREA, Ax}, {ElementProp::VOLUME, Ax*Le},
+				{ElementProp::MASS, Me}});
+		} else {
+			attr.clear();
+		}
+		return;
+	}
+	attr.assign({{ElementProp::LENGTH, Le}, {ElementProp::AREA, Ax}, {ElementProp::VOLUME, Ax*Le},
+		{ElementProp::MASS, Me}, {ElementProp::AW, Ax}, {ElementProp::THICK, Ro-Ri},
+		{ElementProp::OD, U(2)*Ro}, {ElementProp::ID, U(2)*Ri}, {ElementProp::IY, Iyy},
+		{ElementProp::IZ, Izz}, {ElementProp::JX, Jxx}, {ElementProp::SIF, SIF},
+		{ElementProp::PRESIN, sect->get_sect_prop(SectionProp::PRESIN)}, {ElementProp::ANGLE, U(-1)},
+		{ElementProp::RADCUR, U(-1)}});
 }
 
 /**
@@ -171,13 +205,28 @@ elem_out_5<U> StructuralElement<T, U>::pipe16(const NodeBase<T> *p1, const NodeB
 template <class T, class U>
 elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *cen,
 											  const Material<T> *prop, const Section<T> *sect) {
-	matrix_<U> stif = matrix_<U>::Zero(12, 12);
-	matrix_<U> mass = matrix_<U>::Zero(12, 12);
-	vecX_<U> rhs    = vecX_<U>::Zero(12);
-
-	matrix_<U> fij = matrix_<U>::Zero(6, 6);
-	matrix_<U> sij = matrix_<U>::Zero(6, 6);
-	matrix_<U> H   = matrix_<U>::Zero(6, 6);
+	elem_kernel_<U, ElementType::PIPE18> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::pipe18(p1, p2, cen, prop, sect, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *	\brief Curved Pipe Element No.18 in fixed-size matrix.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *cen,
+									 const Material<T> *prop, const Section<T> *sect,
+									 elem_kernel_<U, ElementType::PIPE18> &ke, ElementProperty<U> &attr) {
+	auto &stif = ke.stif;
+	auto &mass = ke.mass;
+	auto &rhs  = ke.rhs;
+	stif.setZero();
+	mass.setZero();
+	rhs.setZero();
+
+	matN_<U, 6> fij = matN_<U, 6>::Zero();
+	matN_<U, 6> sij = matN_<U, 6>::Zero();
+	matN_<U, 6> H   = matN_<U, 6>::Zero();
 
 	U Ro = 0.5*sect->get_sect_prop(SectionProp::OD);
 	decltype(Ro) Ri  = Ro - sect->get_sect_prop(SectionProp::TKWALL);
@@ -190,24 +239,11 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
 	decltype(Ro) R3  = R2*R;
 	decltype(Ro) v   = prop->get_material_prop(MaterialProp::PRXY);
 
-	matrix_<U> tt = matrix_<U>::Zero(3, 3);
-
-	vec3_<T> vxx, vyy, vzz, vxy;
-	vxy = cen->get_xyz() - p1->get_xyz();
-	vxx = p2->get_xyz() - p1->get_xyz();
-
-	decltype(Ro) la = vxx.norm(), lb = vxy.norm();
-	vxx /= vxx.norm();
-	vzz = vxx.cross(vxy);
-	vzz /= vzz.norm();
-	vyy = vzz.cross(vxx);
-	vyy /= vyy.norm();
+	mat3_<U> tt;
+	decltype(Ro) la = NodeFunc<T, U>::coord_tran(p1, p2, cen, tt);//! Chord of elbow.
 
-	tt.row(0) << vxx(0), vxx(1), vxx(2);
-	tt.row(1) << vyy(0), vyy(1), vyy(2);
-	tt.row(2) << vzz(0), vzz(1), vzz(2);
-
-	matrix_<U> loc2gbl = matrix_<U>::Zero(12, 12);
+	auto &loc2gbl = ke.tran;
+	loc2gbl.setZero();
 	for (int i: {0, 1, 2, 3}) loc2gbl.block(i*3, i*3, 3, 3) = tt;
 
 	decltype(Ro) the = 2.0*asin(.5*la/R);
@@ -228,7 +264,7 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
     {
 		decltype(Ro) fluid_dens = sect->get_sect_prop(SectionProp::DENSFL);
 		if (fluid_dens > EPS<>()) Me += fluid_dens*PI<U>()*Ri*Ri*l;
-		if (fluid_dens > EPS<>()) fmt::print("PIPE18 Fluid mass:{}\n", fluid_dens*PI<U>()*Ri*Ri*l);
+		if (fluid_dens > EPS<>() && ke.want(EvalRequest::MASS)) fmt::print("PIPE18 Fluid mass:{}\n", fluid_dens*PI<U>()*Ri*Ri*l);
 	}
 
 	decltype(Ro) kp;
@@ -271,12 +307,12 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
 	stif.block(0, 6, 6, 6) = H*sij;
 	stif.block(6, 0, 6, 6) = sij*H.transpose();
 	stif.block(6, 6, 6, 6) = sij;
-    {
+	if (ke.want(EvalRequest::RHS)) {
 		auto r = Ro - 0.5*t;
 		auto pres = sect->get_sect_prop(SectionProp::PRESIN);
 		auto young = prop->get_material_prop(MaterialProp::YOUNG);
 
-		vecX_<U> B = vecX_<U>::Zero(6);
+		vecN_<U, 6> B = vecN_<U, 6>::Zero();
 		// ANSYS PIPE 18 element ignore angle changes.
 		/*
 		auto DU2 = r/R;
@@ -294,8 +330,8 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
 		B(1) += DUM*(1.0 - cos_the);
 		rhs = stif.block(0, 6, 12, 6)*B;
 	}
-	matrix_<U> tmp = matrix_<U>::Zero(3, 3);
-	matrix_<U> t2  = matrix_<U>::Zero(12, 12);
+	mat3_<U> tmp = mat3_<U>::Zero();
+	matN_<U, 12> t2 = matN_<U, 12>::Zero();
 	decltype(Ro) cos_b = cos(.5*the), sin_b = sin(.5*the);
 
 	tmp.row(0) << cos_b, -sin_b, 0.;
@@ -304,11 +340,13 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
 
 	for (int i: {0, 1, 2, 3}) t2.block(i*3, i*3, 3, 3) = tmp;
 	stif = t2.transpose()*stif*t2;
-    {
+	if (ke.want(EvalRequest::RHS)) {
 		rhs = t2.transpose()*rhs;
 	}
 
-	for (int i: {0, 1, 2, 6, 7, 8}) mass(i, i) = 0.5*Me;
+	if (ke.want(EvalRequest::MASS)) {
+		for (int i: {0, 1, 2, 6, 7, 8}) mass(i, i) = 0.5*Me;
+	}
 	//! From Code-Aster reference formulation.
 	// mass(3, 3) = mass(9, 9) = prop.param[0]*Iyy*R*the;
 	// mass(4, 4) = mass(10, 10) = 2.*prop.param[0]*Iyy*R*the/15.+prop.param[0]*Ax*R*R*the*the*fmin(R*the/105., 1./48.);
@@ -320,32 +358,76 @@ elem_out_5<U> StructuralElement<T, U>::pipe18(const NodeBase<T> *p1, const NodeB
 		decltype(Ro) val = U(0.9)/pow(he, 2./3.);
 		if (val > 1.0) SIF = val;
 	}
-	std::map<std::string, U> attr{{"Length", l}, {"Area", Ax}, {"Volume", Ax*l}, {"Mass", Me},
-	 	{"Aw", Ax}, {"Thick", t}, {"OuterDiameter", U(2)*Ro}, {"InnerDiameter", U(2)*Ri},
-		{"Iy", Iyy}, {"Iz", Iyy}, {"Jx", Jxx}, {"CurvatureRadius", R}, {"Angle", the},
-		{"InternalPressure", sect->get_sect_prop(SectionProp::PRESIN)},
-		{"StressIntensificationFactor", SIF}};
-
-	return std::make_tuple(stif, mass, loc2gbl, rhs, attr);
+	if (!ke.want(EvalRequest::POST)) {
+		if (ke.want(EvalRequest::ATTR)) {
+			attr.assign({{ElementProp::LENGTH, l}, {ElementProp::AREA, Ax}, {ElementProp::VOLUME, Ax*l},
+				{ElementProp::MASS, Me}});
+		} else {
+			attr.clear();
+		}
+		return;
+	}
+	attr.assign({{ElementProp::LENGTH, l}, {ElementProp::AREA, Ax}, {ElementProp::VOLUME, Ax*l},
+		{ElementProp::MASS, Me}, {ElementProp::AW, Ax}, {ElementProp::THICK, t},
+		{ElementProp::OD, U(2)*Ro}, {ElementProp::ID, U(2)*Ri}, {ElementProp::IY, Iyy},
+		{ElementProp::IZ, Iyy}, {ElementProp::JX, Jxx}, {ElementProp::RADCUR, R}, {ElementProp::ANGLE, the},
+		{ElementProp::PRESIN, sect->get_sect_prop(SectionProp::PRESIN)}, {ElementProp::SIF, SIF}});
 }
 
 /**
  * \brief Post-Process of element pipe.
+ * \param[in] req rows of result, stresses of other requests are evaluated by pipe_stress_batch().
  */
 template <class T>
 matrix_<T> StructuralElementPost<T>::pipe(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
-										  const matrix_<T> rhs, const std::map<std::string, T> attr,
-										  bool is_pres, T pres_in, T pres_out) {
+										  const matrix_<T> rhs, const ElementProperty<T> &attr,
+										  bool is_pres, T pres_in, T pres_out, const ResultRequest &req) {
+	if (!req.is_full()) {
+		assert(!is_pres || T(0) == pres_out);
+		matrix_<T> tmp(x.rows(), x.cols());
+		BlockTran<T>::apply(tran, BlockTran<T>::get_pattern(tran), x, tmp);
+		tmp = rhs.col(0) - stif*tmp.col(0);
+		vecX_<T> pres;
+		if (is_pres) pres = vecX_<T>::Constant(1, pres_in);
+		return StructuralElementPost<T>::pipe_stress_batch(StructuralElementPost<T>::pipe_elbow(tmp, attr), attr, pres, req);
+	}
 	// fmt::print("This is for pipe post process in real domain.\n");
 	matrix_<T> esol = matrix_<T>::Zero(99, 2);
-	matrix_<T> tmp  = stif*tran*x;
+	matrix_<T> tmp(x.rows(), x.cols());
+	BlockTran<T>::apply(tran, BlockTran<T>::get_pattern(tran), x, tmp);
+	tmp = stif*tmp;
 	// Element force in local.
 	tmp.col(0) = rhs.col(0) - tmp.col(0);
+	tmp = StructuralElementPost<T>::pipe_elbow(tmp, attr);
 
-	auto get_val = [=] (auto k) { auto p = attr.find(k); return p != attr.end() ? p->second: EPS<T>();};
-
-	// Elbow pipe.
-	auto the = get_val("Angle");
+	// Member force and moment at node I and J in local coordinate.
+	esol.block(0, 0, 6, 1) = tmp.block(0, 0, 6, 1);
+	esol.block(0, 1, 6, 1) = tmp.block(6, 0, 6, 1);
+	StructuralElementPost<T>::pipe_stress(esol, attr, is_pres, pres_in, pres_out);
+	return esol;
+}
+/**
+ * \brief Member force of pipe in local coordinate.
+ * \param[in] x element displacement, one column per load case or mode.
+ * \return member force at node I and J, 12 rows and same columns as x.
+ *
+ * All columns are transformed by one matrix product, which suits modal
+ * responses of response spectrum analysis.
+ */
+template <class T>
+matrix_<T> StructuralElementPost<T>::pipe_force(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
+												const ElementProperty<T> &attr) {
+	matrix_<T> y(x.rows(), x.cols());
+	BlockTran<T>::apply(tran, BlockTran<T>::get_pattern(tran), x, y);
+	matrix_<T> tmp = -(stif*y);
+	return StructuralElementPost<T>::pipe_elbow(tmp, attr);
+}
+/**
+ * \brief Rotate member force of elbow pipe to the tangent of ends.
+ */
+template <class T>
+matrix_<T> StructuralElementPost<T>::pipe_elbow(const matrix_<T> force, const ElementProperty<T> &attr) {
+	auto the = attr.get(ElementProp::ANGLE, EPS<T>());
 	if (the > EPS<T>()) {
 		auto cb = cos(0.5*the);
 		auto sb = sin(0.5*the);
@@ -354,19 +436,23 @@ matrix_<T> StructuralElementPost<T>::pipe(const matrix_<T> stif, const matrix_<T
 		for (int i: {0, 1, 3, 4, 6, 7, 9, 10}) tran(i, i) = cb;
 		tran(1, 0) = tran(4, 3) = tran(6, 7) = tran(9, 10) =  sb;
 		tran(0, 1) = tran(3, 4) = tran(7, 6) = tran(10, 9) = -sb;
-		tmp = tran*tmp;
+		return tran*force;
 	}
-
-	// Member force and moment at node I and J in local coordinate.
-	esol.block(0, 0, 6, 1) = tmp.block(0, 0, 6, 1);
-	esol.block(0, 1, 6, 1) = tmp.block(6, 0, 6, 1);
-
-	auto Aw   = get_val("Aw");
-	auto Pres = get_val("InternalPressure");
-	auto Dout = get_val("OuterDiameter");
-	auto Din  = get_val("InnerDiameter");
-	auto Ir   = get_val("Iy");
-	auto SIF  = get_val("StressIntensificationFactor");
+	return force;
+}
+/**
+ * \brief Stress of pipe from member force in the first 6 rows of esol.
+ */
+template <class T>
+void StructuralElementPost<T>::pipe_stress(matrix_<T> &esol, const ElementProperty<T> &attr,
+										   bool is_pres, T pres_in, T pres_out) {
+	assert(99 == esol.rows() && 2 == esol.cols());
+	auto Aw   = attr.get(ElementProp::AW, EPS<T>());
+	auto Pres = attr.get(ElementProp::PRESIN, EPS<T>());
+	auto Dout = attr.get(ElementProp::OD, EPS<T>());
+	auto Din  = attr.get(ElementProp::ID, EPS<T>());
+	auto Ir   = attr.get(ElementProp::IY, EPS<T>());
+	auto SIF  = attr.get(ElementProp::SIF, EPS<T>());
 
 	auto Ro = Dout/T(2);
 	auto Ri = Din/T(2);
@@ -440,29 +526,230 @@ matrix_<T> StructuralElementPost<T>::pipe(const matrix_<T> stif, const matrix_<T
 		default: fmt::print("Default.\n");
 		}
 	} */
-
-	return esol;
+}
+namespace {
+//! Result of pipe with column and row strides.
+template <class T>
+using stride_map_ = Eigen::Map<matrix_<T>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+/**
+ * \brief Stress of pipe from member forces of cases [k0, k0+m).
+ * \param[out] res rows of request, columns of node I and J of each case.
+ *
+ * Columns of result are evaluated in blocks, with one row per column in a
+ * fixed-size work array of the full layout, so each formula is one
+ * vectorized expression over the block. Only quantities needed by request
+ * are evaluated, at selected circumferential points.
+ */
+template <class T>
+void pipe_stress_cases(const matrix_<T> &force, Eigen::Index k0, Eigen::Index m, const ElementProperty<T> &attr,
+					   const vecX_<T> &pres, const ResultRequest &req, stride_map_<T> res) {
+	const T Aw   = attr.get(ElementProp::AW, EPS<T>());
+	const T Dout = attr.get(ElementProp::OD, EPS<T>());
+	const T Din  = attr.get(ElementProp::ID, EPS<T>());
+	const T Ir   = attr.get(ElementProp::IY, EPS<T>());
+	const T SIF  = attr.get(ElementProp::SIF, EPS<T>());
+	const T Pres = attr.get(ElementProp::PRESIN, EPS<T>());
+	const T Ro = Dout/T(2), Ri = Din/T(2), Jx = T(2)*Ir;
+
+	const PipeResult mohr = PipeResult::S1 | PipeResult::S2 | PipeResult::SEQV;
+	const PipeResult point = mohr | PipeResult::SAXL | PipeResult::SXH;
+	// Work column and row of stored quantities.
+	std::vector<std::array<int, 2>> copy;
+	if (!req.is_full()) {
+		for (int j = 0; j < 6; j++) {
+			if (0 <= req.get_row(PipeResult::FORCE, j)) copy.push_back({j, req.get_row(PipeResult::FORCE, j)});
+		}
+		for (int k = 1; k < 6; k++) {
+			const auto q = static_cast<PipeResult>(1u << k);
+			if (0 <= req.get_row(q)) copy.push_back({5+k, req.get_row(q)});
+		}
+		for (int k = 6; k < 11; k++) {
+			const auto q = static_cast<PipeResult>(1u << k);
+			for (int j = 0; j < ResultRequest::num_point; j++) {
+				if (0 <= req.get_row(q, j)) copy.push_back({11+8*(k-6)+j, req.get_row(q, j)});
+			}
+		}
+	}
+	// Envelopes of SAXL, SXH, S1, S2 and SEQV.
+	std::array<int, 5> env_row;
+	for (int k = 0; k < 5; k++) env_row[k] = req.get_envelope_row(static_cast<PipeResult>(1u << (k+6)));
+
+	constexpr int blk{32}, nr{51};
+	using col_ = Eigen::Array<T, blk, 1>;
+	Eigen::Array<T, blk, nr> w;
+	Eigen::Array<T, blk, 5> env;
+	col_ p, xc, rr;
+	const Eigen::Index num = 2*m;
+	for (Eigen::Index c0 = 0; c0 < num; c0 += blk) {
+		const int nb = static_cast<int>(std::min<Eigen::Index>(blk, num-c0));
+		// Node I in even columns and node J in odd columns.
+		w.setZero();
+		p.setConstant(Pres);
+		for (int i = 0; i < nb; i++) {
+			const auto k = k0+(c0+i)/2;
+			w.row(i).template head<6>() = force.col(k).template segment<6>(6*((c0+i)%2)).transpose().array();
+			if (0 < pres.size()) p(i) = pres(k);
+		}
+		// SDIR, SBEND, ST, SH and SSF.
+		if (req.need(PipeResult::SDIR)) w.col(6) = (w.col(0) + PI<T>()*Ri*Ri*p)/Aw;
+		if (req.need(PipeResult::SBEND)) w.col(7) = SIF*(w.col(4).square() + w.col(5).square()).sqrt()*Ro/Ir;
+		if (req.need(PipeResult::ST)) w.col(8) = w.col(3).abs()*Ro/Jx;
+		if (req.need(PipeResult::SH)) w.col(9) = T(2)*Din*Din*p/(Dout*Dout - Din*Din);
+		if (req.need(PipeResult::SSF)) w.col(10) = T(2)*(w.col(1).square() + w.col(2).square()).sqrt()/Aw;
+		env.setConstant(-std::numeric_limits<T>::infinity());
+		env.col(3).setConstant(std::numeric_limits<T>::infinity());
+		for (int j = 0; j < ResultRequest::num_point && req.need(point); j++) {
+			if (!req.has_point(j)) continue;
+			const T phi = T(.25)*T(j)*PI<T>();
+			// SAXL and SXH on outside surface.
+			if (req.need(PipeResult::SAXL)) w.col(11+j) = w.col(6) + sin(phi)*w.col(7);
+			if (req.need(PipeResult::SXH)) w.col(19+j) = w.col(8) + cos(phi)*w.col(10);
+			if (req.need(mohr)) {
+				// Center and radius of Mohr circle.
+				xc = T(.5)*(w.col(9) + w.col(11+j));
+				rr = T(.5)*((w.col(9) - w.col(11+j)).square() + T(4)*w.col(19+j).square()).sqrt();
+				// S1MX, S2MN and SEQVMX.
+				if (req.need(PipeResult::S1)) w.col(27+j) = xc + rr;
+				if (req.need(PipeResult::S2)) w.col(35+j) = xc - rr;
+				if (req.need(PipeResult::SEQV)) w.col(43+j) = (xc.square() + T(3)*rr.square()).sqrt();
+			}
+			for (int k = 0; k < 5; k++) {
+				if (0 > env_row[k]) continue;
+				if (3 == k) {
+					env.col(k) = env.col(k).min(w.col(11+8*k+j));
+				} else {
+					env.col(k) = env.col(k).max(w.col(11+8*k+j));
+				}
+			}
+		}
+		if (req.is_full()) {
+			res.block(0, c0, nr, nb) = w.topRows(nb).transpose().matrix();
+		} else {
+			for (const auto &c: copy) res.block(c[1], c0, 1, nb) = w.col(c[0]).head(nb).transpose().matrix();
+		}
+		for (int k = 0; k < 5; k++) {
+			if (0 <= env_row[k]) res.block(env_row[k], c0, 1, nb) = env.col(k).head(nb).transpose().matrix();
+		}
+	}
+}
+}
+/**
+ * \brief Stress of pipe from multiple member forces.
+ * \param[in] force member force at node I and J, 12 rows and one column per case.
+ * \param[in] pres internal pressure of each case, PRESIN of attribute when empty.
+ * \param[in] req rows of result.
+ * \return element result, rows of request and columns of node I and J of each case.
+ *
+ * Same formulas as pipe_stress() without outside pressure, vectorized over cases.
+ */
+template <class T>
+matrix_<T> StructuralElementPost<T>::pipe_stress_batch(const matrix_<T> &force, const ElementProperty<T> &attr,
+													   const vecX_<T> &pres, const ResultRequest &req) {
+	assert(12 == force.rows());
+	assert(0 == pres.size() || force.cols() == pres.size());
+	const int nr = req.get_num_row();
+	matrix_<T> res(nr, 2*force.cols());
+	if (req.is_full()) res.bottomRows(48).setZero();
+	pipe_stress_cases(force, 0, force.cols(), attr, pres, req,
+		stride_map_<T>(res.data(), nr, res.cols(), Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(nr, 1)));
+	return res;
 }
 /**
  * \brief Post-Process of element pipe.
+ * \param[in] x element displacement, one column per frequency.
+ * \param[in] rhs element force, one column per frequency.
+ * \param[in] load internal pressure in the first row, one column per frequency.
+ * \param[in] req rows of result.
+ *
+ * Transform, stiffness and elbow rotation are folded into one 12x12 matrix,
+ * so member forces of real and imaginary parts of all frequencies are one
+ * fixed-size product. Stresses of both parts are written to result directly.
  */
 template <class T>
 cmatrix_<T> StructuralElementPost<T>::pipe_cmplx(const matrix_<T> stif, const matrix_<T> tran, const cmatrix_<T> x,
-												 const cmatrix_<T> rhs, const cmatrix_<T> load, const std::map<std::string, T> attr) {
+												 const cmatrix_<T> rhs, const cmatrix_<T> load, const ElementProperty<T> &attr,
+												 const ResultRequest &req) {
 	assert(x.cols() == rhs.cols());
 	assert(x.cols() == load.cols());
-
-	int n_cols{1};
-	if (n_cols < x.cols()) n_cols = x.cols();
-
-	cmatrix_<T> esol = cmatrix_<T>::Zero(99, 2*n_cols);
-
-	for (int i = 0; i < n_cols; i++) {
-		esol.block(0, i*2, 99, 2).real() = StructuralElementPost<T>::pipe(stif, tran,
-			x.col(i).real(), rhs.col(i).real(), attr, true, load(0, i).real());
-		esol.block(0, i*2, 99, 2).imag() = StructuralElementPost<T>::pipe(stif, tran,
-			x.col(i).imag(), rhs.col(i).imag(), attr, true, load(0, i).imag());
-	}
+	assert(12 == stif.rows() && 12 == tran.rows() && 12 == x.rows());
+
+	const int nr = req.get_num_row();
+	const Eigen::Index n = x.cols();
+	if (1 > n) return cmatrix_<T>::Zero(nr, 2);
+	const matN_<T, 12> rot = StructuralElementPost<T>::pipe_elbow(matrix_<T>::Identity(12, 12), attr);
+	const matN_<T, 12> a = rot*Eigen::Map<const matN_<T, 12>>(stif.data())*Eigen::Map<const matN_<T, 12>>(tran.data());
+	// Real parts of all frequencies followed by imaginary parts.
+	Eigen::Matrix<T, 12, Eigen::Dynamic> xs(12, 2*n), rs(12, 2*n);
+	xs << x.real(), x.imag();
+	rs << rhs.real(), rhs.imag();
+	matrix_<T> force = rot*rs;
+	force.noalias() -= a*xs;
+	vecX_<T> pres(2*n);
+	pres << load.row(0).real().transpose(), load.row(0).imag().transpose();
+
+	cmatrix_<T> esol(nr, 2*n);
+	if (req.is_full()) esol.bottomRows(48).setZero();
+	// Real and imaginary parts are interleaved in memory.
+	T *ptr = reinterpret_cast<T*>(esol.data());
+	const Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic> stride(2*nr, 2);
+	pipe_stress_cases(force, 0, n, attr, pres, req, stride_map_<T>(ptr, nr, 2*n, stride));
+	pipe_stress_cases(force, n, n, attr, pres, req, stride_map_<T>(ptr+1, nr, 2*n, stride));
 	return esol;
 }
+/**
+ * \brief Result of load combinations of element pipe.
+ * \param[in] x element displacement, one column per load case.
+ * \param[in] rhs element force, one column per load case.
+ * \param[in] pres internal pressure of each load case, PRESIN of attribute when empty.
+ * \param[in] comb load combinations.
+ * \param[in] req rows of result.
+ * \return element result, rows of request and columns of node I and J of each combination.
+ *
+ * Member forces and pressures of all combinations follow their rules. Stresses
+ * of linear combinations are recomputed from combined forces in one batch,
+ * other rules are applied to rows of results of their terms.
+ */
+template <class T>
+matrix_<T> StructuralElementPost<T>::pipe_combine(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
+												  const matrix_<T> rhs, const vecX_<T> &pres, const ElementProperty<T> &attr,
+												  const LoadCombination<T> &comb, const ResultRequest &req) {
+	const Eigen::Index nc = comb.get_num_case(), nb = comb.get_num_combination();
+	assert(12 == stif.rows() && 12 == tran.rows() && 12 == x.rows());
+	assert(nc == x.cols() && nc == rhs.cols());
+	assert(0 == pres.size() || nc == pres.size());
+
+	const int nr = req.get_num_row();
+	if (1 > nb) return matrix_<T>::Zero(nr, 0);
+	const matN_<T, 12> rot = StructuralElementPost<T>::pipe_elbow(matrix_<T>::Identity(12, 12), attr);
+	const matN_<T, 12> a = rot*Eigen::Map<const matN_<T, 12>>(stif.data())*Eigen::Map<const matN_<T, 12>>(tran.data());
+	matrix_<T> force(12, nc+nb);
+	force.leftCols(nc) = rot*rhs;
+	force.leftCols(nc).noalias() -= a*x;
+	comb.evaluate(force);
+	vecX_<T> p;
+	if (0 < pres.size()) {
+		matrix_<T> tmp(1, nc+nb);
+		tmp.leftCols(nc) = pres.transpose();
+		comb.evaluate(tmp);
+		p = tmp.transpose();
+	}
+	// Load cases and linear combinations from member forces.
+	std::vector<Eigen::Index> col;
+	for (Eigen::Index i = 0; i < nc; i++) col.push_back(i);
+	for (int j = 0; j < nb; j++) {
+		if (CombinationRule::LINEAR == comb.get_rule(j)) col.push_back(nc+j);
+	}
+	const auto nl = static_cast<Eigen::Index>(col.size());
+	matrix_<T> fl(12, nl);
+	vecX_<T> pl(0 < p.size() ? nl: 0);
+	for (Eigen::Index i = 0; i < nl; i++) {
+		fl.col(i) = force.col(col[i]);
+		if (0 < p.size()) pl(i) = p(col[i]);
+	}
+	const matrix_<T> sl = StructuralElementPost<T>::pipe_stress_batch(fl, attr, pl, req);
+	matrix_<T> res(nr, 2*(nc+nb));
+	for (Eigen::Index i = 0; i < nl; i++) res.middleCols(2*col[i], 2) = sl.middleCols(2*i, 2);
+	comb.evaluate(res, 2, true);
+	return res.rightCols(2*nb);
+}
 }  // namespace cafea
@@ -0,0 +1,199 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cassert>
+#include <algorithm>
+
+#include "cafea/element/pipe_batch.hpp"
+
+namespace cafea {
+/**
+ *  \brief Reserve number of elements.
+ */
+template <class T, class U>
+void PipeBatch<T, U>::reserve(size_t n) {
+	for (auto &it: in_) it.reserve(n);
+	out_.reserve(n*NUM_OUT);
+	lumped_.reserve(n);
+}
+
+/**
+ *  \brief Append an element.
+ *  \param [in] p1 start node.
+ *  \param [in] p2 end node.
+ *  \param [in] prop material of element.
+ *  \param [in] sect section of element.
+ *  \param [in] opt options of element.
+ */
+template <class T, class U>
+void PipeBatch<T, U>::add(const NodeBase<T> *p1, const NodeBase<T> *p2, const Material<T> *prop,
+						  const Section<T> *sect, const int *opt) {
+	vec3_<T> vxx = p2->get_xyz() - p1->get_xyz();
+	const T Ro = T(0.5)*sect->get_sect_prop(SectionProp::OD);
+	const T val[NUM_IN] = {vxx(0), vxx(1), vxx(2),
+		prop->get_material_prop(MaterialProp::YOUNG), prop->get_material_prop(MaterialProp::PRXY),
+		prop->get_material_prop(MaterialProp::DENS), Ro, Ro - sect->get_sect_prop(SectionProp::TKWALL),
+		sect->get_sect_prop(SectionProp::DENSFL), sect->get_sect_prop(SectionProp::PRESIN)};
+	for (int i = 0; i < NUM_IN; i++) in_[i].push_back(static_cast<U>(val[i]));
+	lumped_.push_back(0 < opt[0] ? 1: 0);
+}
+
+/**
+ *  \brief Evaluate all elements.
+ *
+ *  Elements are split into blocks that stay in cache, and each field of a
+ *  block is an Eigen array on stack, so every formula runs in SIMD packets
+ *  without branch. Formulas follow pipe16 with alpha equals to 2, vertical
+ *  pipes are selected by mask, and division by constants is replaced by
+ *  multiplication.
+ */
+template <class T, class U>
+void PipeBatch<T, U>::evaluate() {
+	constexpr int blk{128};
+	using arr_ = Eigen::Array<U, Eigen::Dynamic, 1, Eigen::ColMajor, blk, 1>;
+	using map_ = Eigen::Map<Eigen::Array<U, Eigen::Dynamic, 1>, 0, Eigen::InnerStride<NUM_OUT>>;
+	using cmap_ = Eigen::Map<const Eigen::Array<U, Eigen::Dynamic, 1>>;
+	const size_t n = this->size();
+	out_.resize(n*NUM_OUT);
+	const U pi = PI<U>();
+	for (size_t b = 0; b < n; b += blk) {
+		const Eigen::Index m = static_cast<Eigen::Index>(std::min(n - b, size_t(blk)));
+		auto get_in = [this, b, m] (int k) { return cmap_(in_[k].data() + b, m);};
+		// Results are evaluated on stack in packets, then stored per element.
+		auto put = [this, b, m] (int k, const arr_ &x) { map_(out_.data() + b*NUM_OUT + k, m) = x;};
+		const auto dx = get_in(DX), dy = get_in(DY), dz = get_in(DZ);
+		const auto young = get_in(YOUNG), v = get_in(PRXY), dens = get_in(DENS);
+		const auto densfl = get_in(DENSFL);
+		// Coordinate transform.
+		const arr_ le = (dx.square() + dy.square() + dz.square()).sqrt();
+		const arr_ il = le.inverse();
+		const arr_ vx = dx*il, vy = dy*il, vz = dz*il;
+		const arr_ a = (vx.square() + vy.square()).sqrt();
+		const Eigen::Array<bool, Eigen::Dynamic, 1, Eigen::ColMajor, blk, 1> is_vert = a < U(1.e-6);
+		const arr_ sz = (vz < U(0)).select(arr_::Constant(m, U(-1)), U(1));
+		const arr_ ra = is_vert.select(U(0), a.inverse());
+		put(LEN, le);
+		put(T00, is_vert.select(U(0), vx));
+		put(T01, is_vert.select(U(0), vy));
+		put(T02, is_vert.select(sz, vz));
+		put(T10, is_vert.select(U(0), -vy*ra));
+		put(T11, is_vert.select(U(1), vx*ra));
+		put(T12, arr_::Zero(m));
+		put(T20, is_vert.select(-sz, -vx*vz*ra));
+		put(T21, is_vert.select(U(0), -vy*vz*ra));
+		put(T22, is_vert.select(U(0), a));
+		// Section.
+		const arr_ ro2 = get_in(RO).square(), ri2 = get_in(RI).square();
+		const arr_ ax = pi*(ro2 - ri2);
+		const arr_ jx = U(0.5)*pi*(ro2.square() - ri2.square());
+		const arr_ iy = U(0.5)*jx;
+		put(AX, ax);
+		put(JX, jx);
+		put(IY, iy);
+		// Stiffness.
+		const arr_ iv = (U(1) + v).inverse();
+		const arr_ ks = U(4.8e1)*iy*il*il/(ax*iv);
+		const arr_ c = young*iy*il/(U(1) + ks);
+		put(KA, young*ax*il);
+		put(KT, U(0.5)*young*jx*il*iv);
+		put(KB1, U(12)*c*il*il);
+		put(KB2, U(6)*c*il);
+		put(KB3, (U(4) + ks)*c);
+		put(KB4, (U(2) - ks)*c);
+		// Mass.
+		const arr_ me = dens*ax*le, r = dens*iy, mll = me*le*le, ml = me*le;
+		put(ME, me);
+		put(MA, me*U(1./3.));
+		put(MT, dens*jx*le*U(1./3.));
+		put(M11, me*U(13./35.) + U(1.2)*r*il);
+		put(M55, mll*U(1./105.) + le*r*U(2./15.));
+		put(M115, -mll*U(1./140.) - r*le*U(1./30.));
+		put(M51, ml*U(11./210.) + r*U(0.1));
+		put(M75, ml*U(13./420.) - r*U(0.1));
+		put(M71, me*U(9./70.) - U(1.2)*r*il);
+		put(MF, (densfl > EPS<U>()).select(U(0.5)*pi*densfl*ri2*le, U(0)));
+		put(RHS, -pi*ri2*(U(1) - U(2)*v)*get_in(PRESIN));
+	}
+}
+
+/**
+ *  \brief Scatter kernel of element.
+ *  \param [in] i index of element.
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void PipeBatch<T, U>::get_kernel(size_t i, elem_kernel_<U, ElementType::PIPE16> &ke, ElementProperty<U> &attr) const {
+	assert(i < this->size());
+	const U *p = out_.data() + i*NUM_OUT;
+	auto get = [p] (int k) { return p[k];};
+	auto &stif = ke.stif;
+	auto &mass = ke.mass;
+	stif.setZero();
+	mass.setZero();
+	ke.rhs.setZero();
+	ke.tran.setZero();
+	mat3_<U> tt;
+	tt << get(T00), get(T01), get(T02), get(T10), get(T11), get(T12), get(T20), get(T21), get(T22);
+	for (int k: {0, 1, 2, 3}) ke.tran.template block<3, 3>(3*k, 3*k) = tt;
+
+	stif(0, 0) = stif(6, 6) = get(KA);
+	stif(3, 3) = stif(9, 9) = get(KT);
+	stif(6, 0) = stif(0, 6) = -stif(0, 0);
+	stif(9, 3) = stif(3, 9) = -stif(3, 3);
+	for (int k: {0, 1}) {
+		// Bending in XY plane for k equals to 0, and XZ plane with opposite sign of coupling.
+		const int p = 1 + k, q = 5 - k;
+		const U s = 0 == k ? U(1): U(-1);
+		stif(p, p) = stif(p+6, p+6) = get(KB1);
+		stif(q, q) = stif(q+6, q+6) = get(KB3);
+		stif(q, p) = stif(p, q) = s*get(KB2);
+		stif(q+6, q) = stif(q, q+6) = get(KB4);
+		stif(q+6, p+6) = stif(p+6, q+6) = stif(p+6, q) = stif(q, p+6) = -s*get(KB2);
+		stif(q+6, p) = stif(p, q+6) = s*get(KB2);
+		stif(p+6, p) = stif(p, p+6) = -get(KB1);
+	}
+
+	const U me = get(ME), le = get(LEN), r = in_[DENS][i]*get(IY);
+	if (!ke.want(EvalRequest::MASS)) {
+		// Mass is not requested.
+	} else if (lumped_[i]) {
+		for (int k: {0, 1, 2}) mass(k, k) = mass(k+6, k+6) = me/U(2);
+		mass(3, 3) = mass(9, 9) = U(1.5)*get(MT);
+		mass(4, 4) = mass(10, 10) = mass(5, 5) = mass(11, 11) = r/U(2);
+	} else {
+		mass(0, 0) = mass(6, 6) = get(MA);
+		mass(0, 6) = mass(6, 0) = get(MA)/U(2);
+		mass(3, 3) = mass(9, 9) = get(MT);
+		mass(3, 9) = mass(9, 3) = get(MT)/U(2);
+		for (int k: {0, 1}) {
+			const int p = 1 + k, q = 5 - k;
+			const U s = 0 == k ? U(1): U(-1);
+			mass(p, p) = mass(p+6, p+6) = get(M11);
+			mass(q, q) = mass(q+6, q+6) = get(M55);
+			mass(q+6, q) = mass(q, q+6) = get(M115);
+			mass(q, p) = mass(p, q) = s*get(M51);
+			mass(p+6, q) = mass(q, p+6) = s*get(M75);
+			mass(p+6, p) = mass(p, p+6) = get(M71);
+			mass(q+6, p+6) = mass(p+6, q+6) = -s*get(M51);
+			mass(q+6, p) = mass(p, q+6) = -s*get(M75);
+		}
+	}
+	if (ke.want(EvalRequest::MASS)) {
+		for (int k: {0, 1, 2, 6, 7, 8}) mass(k, k) += get(MF);
+	}
+	ke.rhs(0) = get(RHS);
+	ke.rhs(6) = -ke.rhs(0);
+
+	const U ro = in_[RO][i], ri = in_[RI][i], ax = get(AX);
+	attr.assign({{ElementProp::LENGTH, le}, {ElementProp::AREA, ax}, {ElementProp::VOLUME, ax*le},
+		{ElementProp::MASS, me}, {ElementProp::AW, ax}, {ElementProp::THICK, ro-ri},
+		{ElementProp::OD, U(2)*ro}, {ElementProp::ID, U(2)*ri}, {ElementProp::IY, get(IY)},
+		{ElementProp::IZ, get(IY)}, {ElementProp::JX, get(JX)}, {ElementProp::SIF, U(1)},
+		{ElementProp::PRESIN, in_[PRESIN][i]}, {ElementProp::ANGLE, U(-1)},
+		{ElementProp::RADCUR, U(-1)}});
+}
+}  // namespace cafea
@@ -0,0 +1,90 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cassert>
+
+#include "cafea/element/result_request.hpp"
+
+namespace cafea {
+namespace {
+//! Index of single quantity.
+int get_index(PipeResult q) {
+	int k{0};
+	for (auto v = static_cast<unsigned>(q); 1u < v; v >>= 1) k++;
+	assert(static_cast<unsigned>(q) == (1u << k) && 11 > k);
+	return k;
+}
+//! Quantity of index.
+constexpr PipeResult quantity_of(int k) { return static_cast<PipeResult>(1u << k);}
+//! Index of the first quantity at circumferential points.
+constexpr int first_point_index{6};
+}
+
+/**
+ *  \brief Build layout of rows.
+ */
+void ResultRequest::init(PipeResult quantity, unsigned points, PipeResult envelope, bool full) {
+	quantity_ = quantity;
+	envelope_ = envelope;
+	points_ = points & 0xFFu;
+	full_ = full;
+	row_.fill(-1);
+	env_.fill(-1);
+	// Dependencies of stored quantities.
+	auto need = quantity | envelope;
+	if (has_request(need, PipeResult::S1 | PipeResult::S2 | PipeResult::SEQV)) {
+		need = need | PipeResult::SH | PipeResult::SAXL | PipeResult::SXH;
+	}
+	if (has_request(need, PipeResult::SAXL)) need = need | PipeResult::SDIR | PipeResult::SBEND;
+	if (has_request(need, PipeResult::SXH)) need = need | PipeResult::ST | PipeResult::SSF;
+	need_ = need;
+	assert(0 != points_ || static_cast<unsigned>(need) < (1u << first_point_index));
+
+	int npt{0};
+	for (int j = 0; j < num_point; j++) npt += has_point(j) ? 1: 0;
+	int r{0};
+	for (int k = 0; k < 11; k++) {
+		if (!has_request(quantity_, quantity_of(k))) continue;
+		row_[k] = r;
+		r += 0 == k ? 6: (first_point_index > k ? 1: npt);
+	}
+	for (int k = first_point_index; k < 11; k++) {
+		if (has_request(envelope_, quantity_of(k))) env_[k] = r++;
+	}
+	// Rows after SEQV are kept for the full layout.
+	num_row_ = full_ ? 99: r;
+}
+
+/**
+ *  \brief Get row of quantity.
+ *  \param[in] q single quantity.
+ *  \param[in] j component of member force, or circumferential point of point quantities.
+ *  \return row of result, -1 when not stored.
+ */
+int ResultRequest::get_row(PipeResult q, int j) const {
+	const int k = get_index(q);
+	if (0 > row_[k]) return -1;
+	if (0 == k) {
+		assert(0 <= j && 6 > j);
+		return row_[k]+j;
+	}
+	if (first_point_index > k) return row_[k];
+	assert(0 <= j && num_point > j);
+	if (!has_point(j)) return -1;
+	int rank{0};
+	for (int i = 0; i < j; i++) rank += has_point(i) ? 1: 0;
+	return row_[k]+rank;
+}
+
+/**
+ *  \brief Get row of envelope over circumferential points.
+ *  \param[in] q single quantity at circumferential points.
+ *  \return row of result, -1 when not stored.
+ */
+int ResultRequest::get_envelope_row(PipeResult q) const {
+	return env_[get_index(q)];
+}
+}  // namespace cafea
@@ -4,95 +4,263 @@
  *  All rights reserved.
  *  Distributed under GPL v3 license.
  */
-#include <tuple>
-#include <iostream>
-#include <cmath>
-#include <Eigen/Dense>
-#include <Eigen/Geometry>
+#include <array>
 
-#include "cafea/cafea.h"
-
-using std::tie;
-using std::map;
-using std::tuple;
-using std::string;
-using std::make_tuple;
-
-using Eigen::MatrixXd;
-using Eigen::VectorXd;
-using Eigen::Vector3d;
+#include "cafea/utils/shape_function.hpp"
+#include "cafea/element/element_lib.hpp"
 
 namespace cafea {
 namespace {
-template <class T>
-using varargout = tuple<matrix_<T>, matrix_<T>, matrix_<T>, vecX_<T>, map<string, T>>;
+/**
+ *  \brief Degenerated Mindlin shell in fixed-size matrix.
+ *  \tparam ST shape of mid-surface.
+ *  \tparam NGM Gauss points of membrane and bending in each direction.
+ *  \tparam NGS Gauss points of transverse shear and drilling in each direction.
+ *
+ *  Geometry and displacement are interpolated from mid-surface nodes and
+ *  nodal normals, rotations are in global coordinate so transform matrix is
+ *  identity. Strains are taken in lamina coordinate at each point with plane
+ *  stress, and drilling rotation is tied to in-plane rotation by a small
+ *  penalty. Strain-displacement rows of all points are stacked so that each
+ *  part of stiffness is one matrix product.
+ */
+template <ShapeType ST, size_t NGM, size_t NGS, class T, class U, int N>
+void shell_kernel(const NodeBase<T>* const p[], const Material<T> *prop, const Section<T> *sect, const int *opt,
+	ElementKernel<U, N> &ke, ElementProperty<U> &attr) {
+	using shape_ = ShapeFunction<ST, U>;
+	constexpr int nn = static_cast<int>(shape_::num_node);
+	static_assert(N == 6*nn, "Size of shell kernel mismatch.");
+	constexpr auto &tm = shape_table_v<ST, NGM, U>;//! Membrane, bending and mass.
+	constexpr auto &ts = shape_table_v<ST, NGS, U>;//! Transverse shear and drilling.
+	constexpr int npm = static_cast<int>(tm.num_point), nps = static_cast<int>(ts.num_point);
+	const U zeta[2] = {gauss_rule_v<2, 1, U>.pt[0][0], gauss_rule_v<2, 1, U>.pt[1][0]};
+
+	const U t = sect->get_sect_prop(SectionProp::TKWALL), h = U(0.5)*t;
+	const U young = prop->get_material_prop(MaterialProp::YOUNG);
+	const U v = prop->get_material_prop(MaterialProp::PRXY);
+	const U dens = prop->get_material_prop(MaterialProp::DENS);
+	const U G = young*U(0.5)/(U(1)+v);
+	const U kappa{U(5)/U(6)};//! Shear correction factor.
+	const U alpha{U(1.e-3)};//! Penalty of drilling rotation.
+	assert(EPS<U>() < t && EPS<U>() < young);
+	mat3_<U> Dm;
+	Dm << U(1), v, U(0), v, U(1), U(0), U(0), U(0), U(0.5)*(U(1)-v);
+	Dm *= young/(U(1)-v*v);
+
+	Eigen::Matrix<U, 3, nn> xyz, v3;
+	for (int i = 0; i < nn; i++) xyz.col(i) = p[i]->get_xyz().template cast<U>();
+	for (int i = 0; i < nn; i++) {
+		typename shape_::point_ c{};
+		for (size_t d = 0; d < 2; d++) c[d] = U(ShapeNodes<ST>::coord[i][d]);
+		auto dn = shape_::deriv(c);
+		vec3_<U> a1 = xyz*Eigen::Map<const vecN_<U, nn>>(dn[0].data());
+		vec3_<U> a2 = xyz*Eigen::Map<const vecN_<U, nn>>(dn[1].data());
+		v3.col(i) = a1.cross(a2).normalized();
+	}
+	/**
+	 *  Lamina frame and local derivatives at one point.
+	 *  Row q of gm and rm are coefficients of u_i and rotation of node i in
+	 *  derivative along lamina axis q.
+	 */
+	struct Lamina {
+		mat3_<U> e;//!< Columns are lamina axes.
+		U det;//!< Determinant of Jacobian.
+		Eigen::Matrix<U, 3, nn> gm, rm;
+	};
+	auto lamina = [&] (const auto &shp, const auto &dshp, U z) {
+		Eigen::Map<const vecN_<U, nn>> n0(shp.data()), n1(dshp[0].data()), n2(dshp[1].data());
+		Lamina res;
+		mat3_<U> jac;
+		jac.row(0) = (xyz*n1 + z*h*(v3*n1)).transpose();
+		jac.row(1) = (xyz*n2 + z*h*(v3*n2)).transpose();
+		jac.row(2) = h*(v3*n0).transpose();
+		res.det = jac.determinant();
+		assert(EPS<U>() < res.det);
+		vec3_<U> e1 = jac.row(0).transpose().normalized();
+		vec3_<U> e3 = jac.row(0).transpose().cross(jac.row(1).transpose()).normalized();
+		res.e << e1, e3.cross(e1), e3;
+		mat3_<U> q = res.e.transpose()*jac.inverse();
+		Eigen::Matrix<U, 2, nn> dn;
+		dn << n1.transpose(), n2.transpose();
+		res.gm.noalias() = q.template leftCols<2>()*dn;
+		res.rm = z*res.gm + q.col(2)*n0.transpose();
+		return res;
+	};
+	/**
+	 *  Add row of derivative of displacement along axis a in direction
+	 *  of lamina axis q, scaled by s.
+	 */
+	auto add_grad = [&] (auto &&row, const Lamina &lp, int a, int q, U s) {
+		for (int i = 0; i < nn; i++) {
+			vec3_<U> w = v3.col(i).cross(lp.e.col(a));
+			row.template segment<3>(6*i) += s*lp.gm(q, i)*lp.e.col(a).transpose();
+			row.template segment<3>(6*i+3) += s*h*lp.rm(q, i)*w.transpose();
+		}
+	};
+
+	// Membrane and bending, 3 rows at each point.
+	Eigen::Matrix<U, 6*npm, N> bm, dbm;
+	// Transverse shear with 2 rows, and drilling with 1 row.
+	Eigen::Matrix<U, 4*nps+nps, N> bs, dbs;
+	// Shape function of displacement for mass.
+	Eigen::Matrix<U, 6*npm, N> nu;
+	bm.setZero();
+	bs.setZero();
+	nu.setZero();
+	dbm.setZero();
+	dbs.setZero();
+	std::array<U, 2*npm> dv;
+	const bool with_mass = ke.want(EvalRequest::MASS);
+	for (int g = 0; g < npm; g++) {
+		for (int k: {0, 1}) {
+			auto lp = lamina(tm.shp[g], tm.dshp[g], zeta[k]);
+			const int r = 3*(2*g+k);
+			const U wt = tm.rule.wt[g]*lp.det;
+			dv[2*g+k] = wt;
+			add_grad(bm.row(r), lp, 0, 0, U(1));
+			add_grad(bm.row(r+1), lp, 1, 1, U(1));
+			add_grad(bm.row(r+2), lp, 0, 1, U(1));
+			add_grad(bm.row(r+2), lp, 1, 0, U(1));
+			dbm.template middleRows<3>(r).noalias() = wt*Dm*bm.template middleRows<3>(r);
+			if (!with_mass) continue;
+			for (int i = 0; i < nn; i++) {
+				const U ni = tm.shp[g][i];
+				mat3_<U> skew;
+				skew << U(0), -v3(2, i), v3(1, i), v3(2, i), U(0), -v3(0, i), -v3(1, i), v3(0, i), U(0);
+				nu.template block<3, 3>(r, 6*i).diagonal().setConstant(ni);
+				nu.template block<3, 3>(r, 6*i+3) = -zeta[k]*h*ni*skew;
+			}
+		}
+	}
+	for (int g = 0; g < nps; g++) {
+		for (int k: {0, 1}) {
+			auto lp = lamina(ts.shp[g], ts.dshp[g], zeta[k]);
+			const int r = 2*(2*g+k);
+			const U wt = ts.rule.wt[g]*lp.det;
+			add_grad(bs.row(r), lp, 0, 2, U(1));
+			add_grad(bs.row(r), lp, 2, 0, U(1));
+			add_grad(bs.row(r+1), lp, 1, 2, U(1));
+			add_grad(bs.row(r+1), lp, 2, 1, U(1));
+			dbs.template middleRows<2>(r) = wt*kappa*G*bs.template middleRows<2>(r);
+		}
+		// Drilling rotation minus in-plane rotation on mid-surface.
+		auto lp = lamina(ts.shp[g], ts.dshp[g], U(0));
+		const int r = 4*nps+g;
+		for (int i = 0; i < nn; i++) bs.row(r).template segment<3>(6*i+3) = ts.shp[g][i]*lp.e.col(2).transpose();
+		add_grad(bs.row(r), lp, 1, 0, U(-0.5));
+		add_grad(bs.row(r), lp, 0, 1, U(0.5));
+		dbs.row(r) = U(2)*ts.rule.wt[g]*lp.det*alpha*G*bs.row(r);
+	}
+	ke.stif.noalias() = bm.transpose()*dbm;
+	ke.stif.noalias() += bs.transpose()*dbs;
+	ke.stif = U(0.5)*(ke.stif+ke.stif.transpose()).eval();
+
+	U vol{0};
+	for (int r = 0; r < 2*npm; r++) vol += dv[r];
+	if (with_mass) {
+		for (int r = 0; r < 2*npm; r++) dbm.template middleRows<3>(3*r) = dens*dv[r]*nu.template middleRows<3>(3*r);
+		ke.mass.noalias() = nu.transpose()*dbm;
+		ke.mass = U(0.5)*(ke.mass+ke.mass.transpose()).eval();
+	}
+	if (with_mass && nullptr != opt && 0 < opt[0]) {
+		// Diagonal scaling of consistent mass, total mass is kept.
+		vecN_<U, N> diag = ke.mass.diagonal();
+		U tr{0};
+		for (int i = 0; i < nn; i++) tr += diag.template segment<3>(6*i).sum();
+		diag *= U(3)*dens*vol/tr;
+		ke.mass = diag.asDiagonal();
+	}
+	ke.tran.setIdentity();
+	ke.rhs.setZero();
+
+	attr.assign({{ElementProp::LENGTH, U(0)}, {ElementProp::AREA, vol/t}, {ElementProp::VOLUME, vol},
+		{ElementProp::MASS, dens*vol}, {ElementProp::THICK, t}});
+}
 }
 
 /**
- *
+ *  \brief 8-node Mindlin shell element.
  */
 template <class T, class U>
-varargout<U> StructuralElement<T, U>::shell8r(const vector<Node<T, U>> pt, const Material<T> *mp, const Section<T> *sect) {
+elem_out_5<U> StructuralElement<T, U>::shell8r(const std::vector<Node<T, U>> pt, const Material<T> *mp, const Section<T> *sect) {
 	assert(8 == pt.size());
 	return StructuralElement<T, U>::shell8r(&pt[0], &pt[1], &pt[2], &pt[3], &pt[4], &pt[5], &pt[6], &pt[7], mp, sect);
 }
 
-/*
- *
+/**
+ *  \brief 9-node Mindlin shell element.
  */
 template <class T, class U>
-varargout<U> StructuralElement<T, U>::shell9r(const vector<Node<T, U>> pt, const Material<T> *mp, const Section<T> *sect) {
+elem_out_5<U> StructuralElement<T, U>::shell9r(const std::vector<Node<T, U>> pt, const Material<T> *mp, const Section<T> *sect) {
 	assert(9 == pt.size());
-	return StructuralElement<T, U>::shell9R(&pt[0], &pt[1], &pt[2], &pt[3], &pt[4], &pt[5], &pt[6], &pt[7], &pt[8], mp, sect);
+	return StructuralElement<T, U>::shell9r(&pt[0], &pt[1], &pt[2], &pt[3], &pt[4], &pt[5], &pt[6], &pt[7], &pt[8], mp, sect);
 }
 
 /**
- *  \brief
+ *  \brief 8-node Mindlin shell element.
+ *
+ *  \param [in] p1~p4 corner nodes of element.
+ *  \param [in] p5~p8 midside nodes of element.
+ *  \return element_stiffness, element_mass, transform, rhs, attribute
  */
 template <class T, class U>
-varargout<U> StructuralElement<T, U>::shell8r(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *p3,
+elem_out_5<U> StructuralElement<T, U>::shell8r(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *p3,
 											  const NodeBase<T> *p4, const NodeBase<T> *p5, const NodeBase<T> *p6,
 											  const NodeBase<T> *p7, const NodeBase<T> *p8, const Material<T> *prop,
 											  const Section<T> *sect) {
-	const int nn{48};
-	matrix_<U> stif = matrix_<U>::Zero(nn, nn);
-	matrix_<U> mass = matrix_<U>::Zero(nn, nn);
-	matrix_<U> loc2gbl = matrix_<U>::Zero(nn, nn);
-	vecX_<U> rhs = vecX_<U>::Zero(nn);
-
-	U area;
-	matrix_<U> xy = matrix_<U>::Zero(4, 2);
-	matrix_<U> tt = matrix_<U>::Zero(3, 3);
-	tie(area, xy, tt) = NodeFunc<T, U>::coord_tran(p1, p2, p3, p4);
-	for (int i = 0; i < 16; i++) loc2gbl.block(i*3, i*3, 3, 3) = tt;
-
-	map<string, U> attr{{"Length", 0.0}, {"Area", area}, {"Volume", area*t}};
-
-	return make_tuple(stif, mass, loc2gbl, rhs, attr);
+	const NodeBase<T> *pt[8] = {p1, p2, p3, p4, p5, p6, p7, p8};
+	elem_kernel_<U, ElementType::S8R> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::shell8r(pt, prop, sect, nullptr, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *  \brief 8-node Mindlin shell element in fixed-size matrix.
+ *
+ *  Serendipity shape with reduced 2x2 integration.
+ *
+ *  \param [in] p corner nodes followed by midside nodes.
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::shell8r(const NodeBase<T>* const p[], const Material<T> *prop, const Section<T> *sect,
+									  const int *opt, elem_kernel_<U, ElementType::S8R> &ke, ElementProperty<U> &attr) {
+	shell_kernel<ShapeType::QUAD8, 2, 2>(p, prop, sect, opt, ke, attr);
 }
 
 /**
- *  \brief
+ *  \brief 9-node Mindlin shell element.
+ *
+ *  \param [in] p1~p4 corner nodes of element.
+ *  \param [in] p5~p8 midside nodes of element.
+ *  \param [in] p9 center node of element.
+ *  \return element_stiffness, element_mass, transform, rhs, attribute
  */
 template <class T, class U>
-varargout<U> StructuralElement<T, U>::shell9r(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *p3,
+elem_out_5<U> StructuralElement<T, U>::shell9r(const NodeBase<T> *p1, const NodeBase<T> *p2, const NodeBase<T> *p3,
 											  const NodeBase<T> *p4, const NodeBase<T> *p5, const NodeBase<T> *p6,
 											  const NodeBase<T> *p7, const NodeBase<T> *p8, const NodeBase<T> *p9,
 											  const Material<T> *prop, const Section<T> *sect) {
-	const int nn{54};
-	matrix_<U> stif = matrix_<U>::Zero(nn, nn);
-	matrix_<U> mass = matrix_<U>::Zero(nn, nn);
-	matrix_<U> loc2gbl = matrix_<U>::Zero(nn, nn);
-	vecX_<U> rhs = vecX_<U>::Zero(nn);
-
-	U area;
-	matrix_<U> xy = matrix_<U>::Zero(4, 2);
-	matrix_<U> tt = matrix_<U>::Zero(3, 3);
-	tie(area, xy, tt) = NodeFunc<T, U>::coord_tran(p1, p2, p3, p4);
-	for (int i = 0; i < 16; i++) loc2gbl.block(i*3, i*3, 3, 3) = tt;
-
-	map<string, U> attr{{"Length", 0.0}, {"Area", area}, {"Volume", area*t}};
-
-	return make_tuple(stif, mass, loc2gbl, rhs, attr);
+	const NodeBase<T> *pt[9] = {p1, p2, p3, p4, p5, p6, p7, p8, p9};
+	elem_kernel_<U, ElementType::S9R> ke;
+	ElementProperty<U> attr;
+	StructuralElement<T, U>::shell9r(pt, prop, sect, nullptr, ke, attr);
+	return std::make_tuple(matrix_<U>(ke.stif), matrix_<U>(ke.mass), matrix_<U>(ke.tran), vecX_<U>(ke.rhs), attr);
+}
+/**
+ *  \brief 9-node Mindlin shell element in fixed-size matrix.
+ *
+ *  Lagrange shape with full integration of membrane and bending, and
+ *  reduced 2x2 integration of transverse shear.
+ *
+ *  \param [in] p corner nodes, midside nodes and center node.
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::shell9r(const NodeBase<T>* const p[], const Material<T> *prop, const Section<T> *sect,
+									  const int *opt, elem_kernel_<U, ElementType::S9R> &ke, ElementProperty<U> &attr) {
+	shell_kernel<ShapeType::QUAD9, 3, 2>(p, prop, sect, opt, ke, attr);
 }
 }  // namespace cafea
@@ -0,0 +1,147 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <array>
+
+#include "cafea/utils/shape_function.hpp"
+#include "cafea/element/element_lib.hpp"
+
+namespace cafea {
+namespace {
+/**
+ *  \brief Hexahedral solid in fixed-size matrix.
+ *  \tparam ST shape of element.
+ *  \tparam NGK Gauss points of stiffness in each direction.
+ *  \tparam NGM Gauss points of mass in each direction.
+ *
+ *  Derivatives of shape functions at all points come from compile-time
+ *  tables, so Jacobians of all points are one product of the stacked table
+ *  and nodal coordinates. Strain-displacement rows of all points are stacked
+ *  and stiffness is one product of them. Consistent mass is formed once for
+ *  scalar field and expanded to three directions.
+ */
+template <ShapeType ST, size_t NGK, size_t NGM, class T, class U, int N>
+void solid_kernel(const NodeBase<T>* const p[], const Material<T> *prop, const int *opt,
+	ElementKernel<U, N> &ke, ElementProperty<U> &attr) {
+	using shape_ = ShapeFunction<ST, U>;
+	constexpr int nn = static_cast<int>(shape_::num_node);
+	static_assert(N == 3*nn, "Size of solid kernel mismatch.");
+	constexpr auto &tk = shape_table_v<ST, NGK, U>;//! Stiffness.
+	constexpr auto &tm = shape_table_v<ST, NGM, U>;//! Mass.
+	constexpr int npk = static_cast<int>(tk.num_point), npm = static_cast<int>(tm.num_point);
+
+	const U young = prop->get_material_prop(MaterialProp::YOUNG);
+	const U v = prop->get_material_prop(MaterialProp::PRXY);
+	const U dens = prop->get_material_prop(MaterialProp::DENS);
+	assert(EPS<U>() < young && v < U(0.5));
+	const U lambda = young*v/((U(1)+v)*(U(1)-U(2)*v)), mu = U(0.5)*young/(U(1)+v);
+	matN_<U, 6> D = matN_<U, 6>::Zero();
+	D.template topLeftCorner<3, 3>().setConstant(lambda);
+	D.diagonal() << lambda+U(2)*mu, lambda+U(2)*mu, lambda+U(2)*mu, mu, mu, mu;
+
+	Eigen::Matrix<U, nn, 3> xyz;
+	for (int i = 0; i < nn; i++) xyz.row(i) = p[i]->get_xyz().template cast<U>().transpose();
+	// Natural derivatives at all points, 3 rows at each point.
+	Eigen::Matrix<U, 3*npk, nn> dn;
+	for (int g = 0; g < npk; g++) {
+		for (int d = 0; d < 3; d++) dn.row(3*g+d) = Eigen::Map<const Eigen::Matrix<U, 1, nn>>(tk.dshp[g][d].data());
+	}
+	const Eigen::Matrix<U, 3*npk, 3> jac = dn*xyz;
+
+	Eigen::Matrix<U, 6*npk, N> bk, dbk;
+	bk.setZero();
+	for (int g = 0; g < npk; g++) {
+		const mat3_<U> J = jac.template middleRows<3>(3*g);
+		const U det = J.determinant();
+		assert(EPS<U>() < det);
+		// Cartesian derivatives.
+		const Eigen::Matrix<U, 3, nn> dx = J.inverse()*dn.template middleRows<3>(3*g);
+		auto b = bk.template middleRows<6>(6*g);
+		for (int i = 0; i < nn; i++) {
+			b(0, 3*i) = b(3, 3*i+1) = b(5, 3*i+2) = dx(0, i);
+			b(1, 3*i+1) = b(3, 3*i) = b(4, 3*i+2) = dx(1, i);
+			b(2, 3*i+2) = b(4, 3*i+1) = b(5, 3*i) = dx(2, i);
+		}
+		dbk.template middleRows<6>(6*g).noalias() = (tk.rule.wt[g]*det*D)*b;
+	}
+	ke.stif.noalias() = bk.transpose()*dbk;
+	ke.stif = U(0.5)*(ke.stif+ke.stif.transpose()).eval();
+
+	ke.tran.setIdentity();
+	ke.rhs.setZero();
+
+	// Mass of scalar field.
+	const bool with_mass = ke.want(EvalRequest::MASS);
+	Eigen::Matrix<U, npm, nn> sn, wsn;
+	U vol{0};
+	for (int g = 0; g < npm; g++) {
+		mat3_<U> J;
+		for (int d = 0; d < 3; d++) J.row(d) = Eigen::Map<const Eigen::Matrix<U, 1, nn>>(tm.dshp[g][d].data())*xyz;
+		const U wt = tm.rule.wt[g]*J.determinant();
+		vol += wt;
+		if (!with_mass) continue;
+		sn.row(g) = Eigen::Map<const Eigen::Matrix<U, 1, nn>>(tm.shp[g].data());
+		wsn.row(g) = dens*wt*sn.row(g);
+	}
+	attr.assign({{ElementProp::LENGTH, U(0)}, {ElementProp::VOLUME, vol}, {ElementProp::MASS, dens*vol}});
+	if (!with_mass) return;
+
+	const matN_<U, nn> ms = sn.transpose()*wsn;
+	ke.mass.setZero();
+	if (nullptr != opt && 0 < opt[0]) {
+		// Diagonal scaling of consistent mass, total mass is kept.
+		const auto diag = ms.diagonal();
+		const U scale = dens*vol/diag.sum();
+		for (int i = 0; i < nn; i++) {
+			for (int d = 0; d < 3; d++) ke.mass(3*i+d, 3*i+d) = scale*diag(i);
+		}
+	} else {
+		for (int i = 0; i < nn; i++) {
+			for (int j = 0; j < nn; j++) {
+				for (int d = 0; d < 3; d++) ke.mass(3*i+d, 3*j+d) = ms(i, j);
+			}
+		}
+	}
+}
+}
+
+/**
+ *  \brief 8-node hexahedral solid element in fixed-size matrix.
+ *
+ *  Full 2x2x2 integration.
+ *
+ *  \param [in] p nodes of bottom face followed by nodes of top face.
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::solid185(const NodeBase<T>* const p[], const Material<T> *prop, const Section<T>*,
+									   const int *opt, elem_kernel_<U, ElementType::SOLID185> &ke, ElementProperty<U> &attr) {
+	solid_kernel<ShapeType::HEX8, 2, 2>(p, prop, opt, ke, attr);
+}
+
+/**
+ *  \brief 20-node hexahedral solid element in fixed-size matrix.
+ *
+ *  Reduced 2x2x2 integration of stiffness by default and full 3x3x3
+ *  integration when the 2nd option is 1, same as KEYOPT(2) of Ansys.
+ *  Mass is integrated by 3x3x3 points.
+ *
+ *  \param [in] p corner nodes, midside nodes of bottom and top faces, then
+ *  midside nodes of vertical edges.
+ *  \param [out] ke element stiffness, mass, transform and rhs.
+ *  \param [out] attr attribute of element.
+ */
+template <class T, class U>
+void StructuralElement<T, U>::solid186(const NodeBase<T>* const p[], const Material<T> *prop, const Section<T>*,
+									   const int *opt, elem_kernel_<U, ElementType::SOLID186> &ke, ElementProperty<U> &attr) {
+	if (nullptr != opt && 1 == opt[1]) {
+		solid_kernel<ShapeType::HEX20, 3, 3>(p, prop, opt, ke, attr);
+	} else {
+		solid_kernel<ShapeType::HEX20, 2, 3>(p, prop, opt, ke, attr);
+	}
+}
+}  // namespace cafea
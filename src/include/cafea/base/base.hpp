@@ -8,69 +8,120 @@
 #define CAFEA_BASE_HPP_
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <array>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <ostream>
 #include <algorithm>
+#include <type_traits>
+#include <unordered_map>
 
 #include "fmt/format.h"
 
 #include "cafea/utils/utils.hpp"
 
 namespace cafea {
+/**
+ *  \brief Pool of interned strings.
+ *
+ *  Each string is stored once and never removed, so objects keep only the
+ *  index of their strings. Index 0 is empty string and index 1 is "Empty".
+ */
+class StringPool {
+	public:
+		//! Get index of string, string is added when it is new.
+		static uint32_t intern(const std::string&);
+		//! Get index of string, last string of thread is checked first.
+		static uint32_t intern(const char*);
+		//! Get string of index.
+		static std::string get(uint32_t);
+		//! Get number of strings.
+		static size_t size();
+
+	private:
+		//! Storage of pool.
+		struct Data {
+			std::mutex mtx;//!< Lock of pool.
+			std::deque<std::string> str{"", "Empty"};//!< Strings, which never move.
+			std::unordered_map<std::string, uint32_t> index{{"", 0}, {"Empty", 1}};//!< Index of strings.
+		};
+		//! Get storage of pool.
+		static Data& data();
+		//! Get index and address of string under lock.
+		static uint32_t intern(const std::string&, const std::string**);
+};
+/**
+ *  \brief Tags and groups of objects.
+ *
+ *  Few objects have tags or groups, so they are kept in a side table keyed
+ *  by kind and id of object instead of in each object. Objects of the same
+ *  kind and id share attributes, such as copies of a node.
+ */
+class ObjectTable {
+	public:
+		//! Attributes of object.
+		struct Attr {
+			std::array<uint32_t, 10> tags{};//!< Index of tags in StringPool.
+			std::array<int, 10> group{};//!< Groups.
+		};
+		//! Get attributes of object, default when none is set.
+		static Attr get(uint32_t kind, int id);
+		//! Modify attributes of object.
+		template <class F>
+		static void update(uint32_t kind, int id, F &&fn) {
+			auto &d = data();
+			std::lock_guard<std::mutex> lock(d.mtx);
+			fn(d.attr[key(kind, id)]);
+		}
+		//! Clear attributes of all objects.
+		static void clear();
+		//! Get number of objects with attributes.
+		static size_t size();
+
+	private:
+		//! Storage of table.
+		struct Data {
+			std::mutex mtx;//!< Lock of table.
+			std::unordered_map<uint64_t, Attr> attr;//!< Attributes of objects.
+		};
+		//! Get storage of table.
+		static Data& data();
+		//! Key of object.
+		static uint64_t key(uint32_t kind, int id) {
+			return (uint64_t(kind) << 32) | static_cast<uint32_t>(id);
+		}
+};
 /**
  * \class ObjectBase
  *  Basic parent object.
+ *
+ *  Only id, kind and name in StringPool are stored, name is formatted when
+ *  it is requested, and tags and groups are kept in ObjectTable.
  */
 class ObjectBase {
 	public:
 		//! Constructor.
-		ObjectBase() { group_.fill(0);}
+		ObjectBase() {}
 		//! Another constructor.
-		ObjectBase(int id, const std::string s, const char delimeter = '#') {
-			assert(id > 0);
-			id_ = id;
-			name_ = fmt::format("{0}{1}{2}", s, delimeter, id);
-			group_.fill(0);
-		}
+		ObjectBase(int id, const std::string &s, const char delimeter = '#'):
+			id_(id), kind_(StringPool::intern(s)), name_(kind_), delim_(delimeter) { assert(id > 0);}
 		//! Another constructor.
-		ObjectBase(int id, const char* s, const char delimeter = '#') {
-			assert(id > 0);
-			id_ = id;
-			name_ = fmt::format("{0}{1}{2}", s, delimeter, id);
-			group_.fill(0);
-		}
+		ObjectBase(int id, const char* s, const char delimeter = '#'):
+			id_(id), kind_(StringPool::intern(s)), name_(kind_), delim_(delimeter) { assert(id > 0);}
 		//! Another constructor.
-		explicit ObjectBase(int id): id_(id) {
-			assert(id_ > 0);
-			group_.fill(0);
-		}
+		explicit ObjectBase(int id): id_(id) { assert(id_ > 0);}
 		//! A destructor.
 		virtual ~ObjectBase() {}
-		// //! Set object's name.
-		// template <class T>
-		// void set_name(T val) { name_ = fmt::format("{}", val);}
 		//! Set object's name by id.
 		template <class T>
 		void set_name(T val, bool suffix_by_id = false, const char delimeter = '#') {
-			if (suffix_by_id) {
-				name_ = fmt::format("{0}{1}{2}", val, delimeter, id_);
-			} else {
-				name_ = fmt::format("{}", val);
-			}
+			name_ = StringPool::intern(fmt::format("{}", val));
+			delim_ = suffix_by_id ? delimeter: '\0';
 		}
-		/*
-		//! Set numeric number for object's name.
-		template <class T>
-		void set_name(T val)
-		{
-			static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value);
-			name_ = std::to_string(val);
-		};
-		//! Set object's name.
-		void set_name(std::string s) { name_ = s;};
-		void set_name(const char *cs) { name_ = cs;};
-		*/
 		//! Set object's id.
 		void set_id(int x) {
 			assert(x > 0);
@@ -85,57 +136,75 @@ class ObjectBase {
 		 */
 		void set_group(init_list_<int> abc) {
 			assert(abc.size() <= 10);
-			std::copy(abc.begin(), abc.end(), group_.begin());
+			ObjectTable::update(kind_, id_, [&abc] (auto &a) { std::copy(abc.begin(), abc.end(), a.group.begin());});
 		}
 		//! Set object's group via C-style.
 		void set_group(const int y[], int n) {
 			assert(0 < n && n <= 10);
-			for (int i = 0; i < n; i++) group_[i] = y[i];
+			ObjectTable::update(kind_, id_, [&] (auto &a) { std::copy(y, y+n, a.group.begin());});
 		}
 		//! Set object's tags.
 		template <class T, std::size_t N>
 		void set_tags(const T(&vals)[N]) {
 			static_assert(0 < N && N <= 10);
-			std::transform(std::begin(vals), std::end(vals), tags_.begin(),
-				[] (T a)->std::string { return fmt::format("{}", a);});
+			std::array<uint32_t, N> tmp;
+			std::transform(std::begin(vals), std::end(vals), tmp.begin(), [] (T a) { return to_tag(a);});
+			ObjectTable::update(kind_, id_, [&tmp] (auto &a) { std::copy(tmp.begin(), tmp.end(), a.tags.begin());});
 		}
 		//! Set object's tags.
 		template <class ...Args>
 		void set_tags(Args&&... args) {
 			static_assert(10 >= sizeof...(args));
-			std::vector<std::string> tempVec;
-			(tempVec.emplace_back(fmt::format("{}", std::forward<Args>(args))), ...);
-			std::copy(tempVec.begin(), tempVec.end(), tags_.begin());
+			const std::array<uint32_t, sizeof...(args)> tmp{to_tag(std::forward<Args>(args))...};
+			ObjectTable::update(kind_, id_, [&tmp] (auto &a) { std::copy(tmp.begin(), tmp.end(), a.tags.begin());});
 		}
 		//! Set object's tag by index.
 		template <class T>
 		void set_tag_by_index(T val, int indx=0) {
 			assert(0 <= indx && indx <=9);
-			tags_[indx] = fmt::format("{}", val);
+			const auto tmp = to_tag(val);
+			ObjectTable::update(kind_, id_, [tmp, indx] (auto &a) { a.tags[indx] = tmp;});
 		}
 		//! Get object's tags.
-		std::array<std::string, 10> get_tags() const { return tags_;}
+		std::array<std::string, 10> get_tags() const {
+			std::array<std::string, 10> res;
+			const auto a = ObjectTable::get(kind_, id_);
+			for (size_t i = 0; i < res.size(); i++) res[i] = StringPool::get(a.tags[i]);
+			return res;
+		}
 		//! Get object's tag by index.
-		std::string get_tag_by_index(int indx=0) {
+		std::string get_tag_by_index(int indx=0) const {
 			assert(0 <= indx && indx <= 9);
-			return tags_[indx];
+			return StringPool::get(ObjectTable::get(kind_, id_).tags[indx]);
 		}
 		//! Get object's name.
-		std::string get_name() const { return name_;}
+		std::string get_name() const {
+			if ('\0' == delim_) return StringPool::get(name_);
+			return fmt::format("{0}{1}{2}", StringPool::get(name_), delim_, id_);
+		}
 		//! Get object's id.
 		int get_id() const { return id_;}
 		//! Get object's group.
-		std::array<int, 10> get_group() const { return group_;}
+		std::array<int, 10> get_group() const { return ObjectTable::get(kind_, id_).group;}
 		//! Print object's id and name.
 		friend std::ostream& operator<<(std::ostream& cout, const ObjectBase &a) {
-			return cout << fmt::format("Object id:{} name:{}\n", a.id_, a.name_);
+			return cout << fmt::format("Object id:{} name:{}\n", a.id_, a.get_name());
 		}
 
 	protected:
 		int id_{-1};//!< Object's id.
-		std::array<int, 10> group_;//!< Object's group array.
-		std::array<std::string, 10> tags_;//!< Object's tags array.
-		std::string name_{"Empty"};//!< Object's name.
+		uint32_t kind_{0};//!< Kind of object given at construction, index in StringPool.
+		uint32_t name_{1};//!< Object's name, index in StringPool.
+		char delim_{'\0'};//!< Delimeter of id suffix of name, no suffix when it is zero.
+		//! Format tag, floating point in general format, and return index in StringPool.
+		template <class T>
+		static uint32_t to_tag(T&& val) {
+			if constexpr (std::is_floating_point_v<std::decay_t<T>>) {
+				return StringPool::intern(fmt::format("{:g}", val));
+			} else {
+				return StringPool::intern(fmt::format("{}", std::forward<T>(val)));
+			}
+		}
 };
 }  // namespace cafea
 #endif  // CAFEA_BASE_HPP_
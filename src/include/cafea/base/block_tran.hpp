@@ -0,0 +1,44 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_BLOCK_TRAN_HPP_
+#define CAFEA_BLOCK_TRAN_HPP_
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Transform of element matrix by 3x3 block rotations.
+ *
+ *  Transform matrix of line elements is block diagonal with 3x3 rotations,
+ *  so \f$ T^TKT \f$ is evaluated block by block as \f$ R_i^TK_{ij}R_j \f$
+ *  instead of two dense products. Identity transform is copied directly.
+ */
+template <class T = REAL8>
+struct BlockTran {
+	//! Detect pattern of transform matrix.
+	static TranPattern get_pattern(const Eigen::Ref<const matrix_<T>> &tran);
+	//! Fused transform of stiffness, mass and rhs to global coordinate.
+	static void transform(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+		const Eigen::Ref<const matrix_<T>> &stif, const Eigen::Ref<const matrix_<T>> &mass,
+		const Eigen::Ref<const vecX_<T>> &rhs, Eigen::Ref<matrix_<T>> stif_g,
+		Eigen::Ref<matrix_<T>> mass_g, Eigen::Ref<vecX_<T>> rhs_g);
+	//! Multiply transform matrix, y = T*x.
+	static void apply(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+		const Eigen::Ref<const matrix_<T>> &x, Eigen::Ref<matrix_<T>> y);
+	//! Multiply transpose of transform matrix, y = T'*x.
+	static void apply_transpose(const Eigen::Ref<const matrix_<T>> &tran, TranPattern pat,
+		const Eigen::Ref<const matrix_<T>> &x, Eigen::Ref<matrix_<T>> y);
+};
+
+// //!< Specialization.
+template struct BlockTran<REAL4>;
+template struct BlockTran<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_BLOCK_TRAN_HPP_
@@ -59,7 +59,7 @@ class Boundary: public ObjectBase {
 		T get_boundary_val() const { return val_;}
 		//! Print boundary.
 		friend std::ostream& operator<<(std::ostream& cout, const Boundary &a) {
-			return cout << fmt::format("{}\n", a.name_);
+			return cout << fmt::format("{}\n", a.get_name());
 		}
 
 	private:
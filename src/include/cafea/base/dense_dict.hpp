@@ -0,0 +1,153 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_DENSE_DICT_HPP_
+#define CAFEA_DENSE_DICT_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+#include <utility>
+#include <tuple>
+
+#include "cafea/utils/utils.hpp"
+
+namespace cafea {
+/**
+ *  \brief Dictionary of model objects stored contiguously.
+ *
+ *  Items are kept in one vector of id and value pairs in order of insertion,
+ *  and ids are mapped to indices by a hash table. Interface of find(), at()
+ *  and iteration follows dict_, while value(i) gives array access by index.
+ *  Items are never erased one by one, so indices are stable after loading.
+ */
+template <class T>
+class DenseDict {
+	public:
+		using value_type = std::pair<int, T>;//!< Id and value.
+		using iterator = typename std::vector<value_type>::iterator;//!< Iterator.
+		using const_iterator = typename std::vector<value_type>::const_iterator;//!< Const iterator.
+		//! Append item when id is new, otherwise return the existing one.
+		template <class... Args>
+		std::pair<iterator, bool> emplace(int id, Args&&... args) {
+			auto got = index_.emplace(id, item_.size());
+			if (!got.second) return {item_.begin()+got.first->second, false};
+			item_.emplace_back(std::piecewise_construct, std::forward_as_tuple(id),
+				std::forward_as_tuple(std::forward<Args>(args)...));
+			return {item_.end()-1, true};
+		}
+		//! Reserve number of items.
+		void reserve(size_t n) {
+			item_.reserve(n);
+			index_.reserve(n);
+		}
+		//! Clear items.
+		void clear() {
+			item_.clear();
+			index_.clear();
+		}
+		//! Get number of items.
+		size_t size() const { return item_.size();}
+		//! Dictionary is empty or not.
+		bool empty() const { return item_.empty();}
+		//! Get index of id, -1 when not found.
+		int index(int id) const {
+			auto got = index_.find(id);
+			return got == index_.end() ? -1: static_cast<int>(got->second);
+		}
+		//! Find item of id.
+		iterator find(int id) {
+			const int i = index(id);
+			return 0 > i ? item_.end(): item_.begin()+i;
+		}
+		//! Find item of id.
+		const_iterator find(int id) const {
+			const int i = index(id);
+			return 0 > i ? item_.end(): item_.begin()+i;
+		}
+		//! Get value of id, which must exist.
+		T& at(int id) { return value(static_cast<size_t>(checked_index(id)));}
+		//! Get value of id, which must exist.
+		const T& at(int id) const { return value(static_cast<size_t>(checked_index(id)));}
+		//! Get value of i-th item.
+		T& value(size_t i) {
+			assert(i < item_.size());
+			return item_[i].second;
+		}
+		//! Get value of i-th item.
+		const T& value(size_t i) const {
+			assert(i < item_.size());
+			return item_[i].second;
+		}
+		//! Get id of i-th item.
+		int get_id(size_t i) const { return item_[i].first;}
+		iterator begin() { return item_.begin();}//!< First item.
+		iterator end() { return item_.end();}//!< Past the last item.
+		const_iterator begin() const { return item_.begin();}//!< First item.
+		const_iterator end() const { return item_.end();}//!< Past the last item.
+
+	private:
+		std::vector<value_type> item_;//!< Id and value of items.
+		dict_<size_t> index_;//!< Index of id.
+
+		//! Index of id which must exist.
+		int checked_index(int id) const {
+			const int i = index(id);
+			assert(0 <= i);
+			return i;
+		}
+};
+
+/**
+ *  \brief Element connectivity resolved to indices of dictionaries.
+ *
+ *  Nodes of elements are stored in compressed rows, with material and
+ *  section index of each element, in order of element dictionary. Missing
+ *  objects are -1.
+ */
+class Connectivity {
+	public:
+		//! Resolve elements to indices of node, material and section dictionaries.
+		template <class E, class N, class M, class S>
+		void init(const DenseDict<E> &elem, const DenseDict<N> &node, const DenseDict<M> &matl,
+			const DenseDict<S> &sect) {
+			clear();
+			ptr_.reserve(elem.size()+1);
+			matl_.reserve(elem.size());
+			sect_.reserve(elem.size());
+			for (const auto &it: elem) {
+				for (auto id: it.second.get_node_list()) node_.push_back(node.index(id));
+				ptr_.push_back(node_.size());
+				matl_.push_back(matl.index(it.second.get_material_id()));
+				sect_.push_back(sect.index(it.second.get_section_id()));
+			}
+		}
+		//! Clear variables.
+		void clear() {
+			ptr_.assign(1, 0);
+			node_.clear();
+			matl_.clear();
+			sect_.clear();
+		}
+		//! Get number of elements.
+		size_t get_num_elem() const { return matl_.size();}
+		//! Get number of nodes of e-th element.
+		size_t get_num_node(size_t e) const { return ptr_[e+1]-ptr_[e];}
+		//! Get node indices of e-th element.
+		const int* get_node(size_t e) const { return node_.data()+ptr_[e];}
+		//! Get material index of e-th element.
+		int get_material(size_t e) const { return matl_[e];}
+		//! Get section index of e-th element.
+		int get_section(size_t e) const { return sect_[e];}
+
+	private:
+		std::vector<size_t> ptr_{0};//!< Offset of nodes of elements.
+		std::vector<int> node_;//!< Node indices.
+		std::vector<int> matl_;//!< Material index of elements.
+		std::vector<int> sect_;//!< Section index of elements.
+};
+}  // namespace cafea
+#endif  // CAFEA_DENSE_DICT_HPP_
@@ -26,7 +26,7 @@ class DofHandler {
 		//! Clear.
 		void clear() { if (!dofs_.empty()) dofs_.clear();}
 		//! Get DOF vector.
-		std::vector<int> get_dofs() const { return dofs_;}
+		const std::vector<int>& get_dofs() const { return dofs_;}
 		//! Apply constraint.
 		void set_constraint(DofLabel, DofType);
 		//! Accumulate.
@@ -0,0 +1,116 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_DOF_PARTITION_HPP_
+#define CAFEA_DOF_PARTITION_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+
+namespace cafea {
+/**
+ *  \brief Partition of global dofs into free and prescribed sets.
+ *
+ *  \f[ \begin{bmatrix} A_{ff} & A_{fp} \\ A_{pf} & A_{pp} \end{bmatrix}
+ *  \begin{Bmatrix} x_f \\ u_p \end{Bmatrix} = \begin{Bmatrix} b_f \\ r_p \end{Bmatrix}
+ *  \Rightarrow A_{ff}x_f = b_f - A_{fp}u_p \f]
+ *  Index maps are built once, and the sparse pattern of each block
+ *  does not change with the values of the global matrix.
+ */
+class DofPartition {
+	public:
+		//! Split dofs with prescribed index list.
+		void init(size_t dim, std::vector<size_t> fixed);
+		//! Clear variables.
+		void clear() {
+			index_.clear();
+			free_.clear();
+			fixed_.clear();
+		}
+		//! Get dimension of global matrix.
+		size_t get_dim() const { return index_.size();}
+		//! Get number of free dofs.
+		size_t get_num_free() const { return free_.size();}
+		//! Get number of prescribed dofs.
+		size_t get_num_fixed() const { return fixed_.size();}
+		//! Inquire prescribed dofs exist.
+		bool has_fixed() const { return !fixed_.empty();}
+		//! Get index in free set, -1 when prescribed.
+		int get_free_index(size_t i) const { return 0 <= index_[i] ? index_[i]: -1;}
+		//! Get index in prescribed set, -1 when free.
+		int get_fixed_index(size_t i) const { return 0 > index_[i] ? -index_[i]-1: -1;}
+		//! Get global index of free dofs.
+		const std::vector<size_t>& get_free_list() const { return free_;}
+		//! Get global index of prescribed dofs.
+		const std::vector<size_t>& get_fixed_list() const { return fixed_;}
+		//! Extract free-free block.
+		template <class T>
+		Eigen::SparseMatrix<T> get_ff(const Eigen::SparseMatrix<T> &A) const { return extract(A, true);}
+		//! Extract free-prescribed block.
+		template <class T>
+		Eigen::SparseMatrix<T> get_fp(const Eigen::SparseMatrix<T> &A) const { return extract(A, false);}
+		//! Gather free part of global vector.
+		template <class T>
+		vecX_<T> get_free(const vecX_<T> &b) const {
+			assert(static_cast<size_t>(b.size()) == index_.size());
+			vecX_<T> bf(free_.size());
+			for (size_t i = 0; i < free_.size(); i++) bf(i) = b(free_[i]);
+			return bf;
+		}
+		//! Reduced right hand side \f$ b_f - A_{fp}u_p \f$.
+		template <class T>
+		vecX_<T> get_rhs(const vecX_<T> &b, const Eigen::SparseMatrix<T> &A_fp, const vecX_<T> &u_p) const {
+			vecX_<T> bf = get_free(b);
+			if (has_fixed()) bf -= A_fp*u_p;
+			return bf;
+		}
+		//! Scatter free and prescribed part to global vector.
+		template <class T>
+		vecX_<T> expand(const vecX_<T> &x_f, const vecX_<T> &u_p) const {
+			assert(static_cast<size_t>(x_f.size()) == free_.size());
+			assert(static_cast<size_t>(u_p.size()) == fixed_.size());
+			vecX_<T> x(index_.size());
+			for (size_t i = 0; i < free_.size(); i++) x(free_[i]) = x_f(i);
+			for (size_t i = 0; i < fixed_.size(); i++) x(fixed_[i]) = u_p(i);
+			return x;
+		}
+
+	private:
+		std::vector<int> index_;//!< Global to local index, prescribed k is -k-1.
+		std::vector<size_t> free_;//!< Global index of free dofs.
+		std::vector<size_t> fixed_;//!< Global index of prescribed dofs.
+
+		//! Extract free rows with free or prescribed columns.
+		template <class T>
+		Eigen::SparseMatrix<T> extract(const Eigen::SparseMatrix<T> &A, bool free_col) const {
+			assert(static_cast<size_t>(A.rows()) == index_.size());
+			assert(static_cast<size_t>(A.cols()) == index_.size());
+			const auto num_col = free_col ? free_.size(): fixed_.size();
+			Eigen::SparseMatrix<T> B(free_.size(), num_col);
+			std::vector<Eigen::Triplet<T>> tri_list;
+			tri_list.reserve(A.nonZeros());
+			for (int k = 0; k < A.outerSize(); k++) {
+				for (typename Eigen::SparseMatrix<T>::InnerIterator it(A, k); it; ++it) {
+					int ir = index_[it.row()], jc = index_[it.col()];
+					if (0 > ir) continue;
+					if (free_col && 0 <= jc) {
+						tri_list.emplace_back(ir, jc, it.value());
+					} else if (!free_col && 0 > jc) {
+						tri_list.emplace_back(ir, -jc-1, it.value());
+					}
+				}
+			}
+			B.setFromTriplets(tri_list.begin(), tri_list.end());
+			return B;
+		}
+};
+}  // namespace cafea
+#endif  // CAFEA_DOF_PARTITION_HPP_
@@ -0,0 +1,86 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_DOF_TABLE_HPP_
+#define CAFEA_DOF_TABLE_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+
+#include "cafea/utils/utils.hpp"
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Model-wide table of global dofs.
+ *
+ *  Dofs of all nodes are stored in one contiguous array with offset of each
+ *  node, after numbering by DofHandler. Equations are non-negative, and
+ *  constrained or unused dofs keep their negative DofType code. Lookups
+ *  return pointers into the table, so loops of analyze, assembly, solve and
+ *  post process do not allocate.
+ */
+class DofTable {
+	public:
+		//! Reserve number of nodes and dofs.
+		void reserve(size_t num_node, size_t num_dof) {
+			id_.reserve(num_node);
+			ptr_.reserve(num_node+1);
+			dof_.reserve(num_dof);
+		}
+		//! Append dofs of node, return index of node.
+		size_t add(int id, const std::vector<int> &dofs);
+		//! Clear variables.
+		void clear() {
+			id_.clear();
+			index_.clear();
+			ptr_.assign(1, 0);
+			dof_.clear();
+			dim_ = 0;
+		}
+		//! Get number of nodes.
+		size_t get_num_node() const { return id_.size();}
+		//! Get number of equations.
+		int get_dim() const { return dim_;}
+		//! Get index of node id, -1 when not found.
+		int find(int id) const {
+			auto got = index_.find(id);
+			return got == index_.end() ? -1: static_cast<int>(got->second);
+		}
+		//! Get id of i-th node.
+		int get_node_id(size_t i) const { return id_[i];}
+		//! Get number of dofs of i-th node.
+		size_t get_num_dofs(size_t i) const { return ptr_[i+1]-ptr_[i];}
+		//! Get dofs of i-th node.
+		const int* get_dofs(size_t i) const {
+			assert(i < id_.size());
+			return dof_.data()+ptr_[i];
+		}
+		//! Get equation of j-th dof of i-th node, negative when constrained or not found.
+		int get_dof(size_t i, size_t j) const {
+			return j < get_num_dofs(i) ? dof_[ptr_[i]+j]: static_cast<int>(DofType::UNKNOWN);
+		}
+		//! Get equation of j-th dof of node id, negative when constrained or not found.
+		int get_dof_by_id(int id, size_t j) const {
+			const int i = find(id);
+			return 0 > i ? static_cast<int>(DofType::UNKNOWN): get_dof(static_cast<size_t>(i), j);
+		}
+		//! Get constraint of j-th dof of i-th node, NORMAL when it has equation.
+		DofType get_constraint(size_t i, size_t j) const {
+			const int v = get_dof(i, j);
+			return 0 <= v ? DofType::NORMAL: static_cast<DofType>(v);
+		}
+
+	private:
+		std::vector<int> id_;//!< Node id.
+		dict_<size_t> index_;//!< Index of node id.
+		std::vector<size_t> ptr_{0};//!< Offset of dofs of each node.
+		std::vector<int> dof_;//!< Dofs of all nodes.
+		int dim_{0};//!< Number of equations.
+};
+}  // namespace cafea
+#endif  // CAFEA_DOF_TABLE_HPP_
@@ -24,6 +24,11 @@ class LinearSolver {
 		virtual ~LinearSolver() { clear();}
 		//! Load K.
 		void load(const T*, const SparseCell*, size_t, size_t);
+		//! Load K in Eigen sparse format.
+		void load(const Eigen::SparseMatrix<T> &A) {
+			clear();
+			matA_ = A;
+		}
 		//! Analyze pattern.
 		void analyze() { solver_.analyzePattern(matA_); isAnalyzed_ = true;}
 		//! Factorize matirx K.
@@ -51,6 +56,13 @@ class LinearSolver {
 			}
 			return  isSolved_;
 		}
+		//! Solve.
+		bool solve(const vecX_<T> &rhs) {
+			analyze_factorize();
+			xx_ = solver_.solve(rhs);
+			isSolved_ = solver_.info() == Eigen::ComputationInfo::Success;
+			return isSolved_;
+		}
 		//! Clear variables.
 		virtual void clear() {
 			matA_.resize(0, 0);
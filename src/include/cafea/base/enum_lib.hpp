@@ -145,6 +145,90 @@ enum struct SectionProp {
 	UNKNOWN = -99,
 };
 
+/**
+ *  \enum Element property.
+ */
+enum struct ElementProp {
+	LENGTH,//!< Length.
+	AREA,//!< Cross section area.
+	VOLUME,//!< Volume.
+	MASS,//!< Mass.
+	AW,//!< Wall area of pipe.
+	THICK,//!< Wall thickness.
+	OD,//!< Outer diameter.
+	ID,//!< Inner diameter.
+	IY,//!< Moment of inertia about Y.
+	IZ,//!< Moment of inertia about Z.
+	JX,//!< Torsional moment of inertia.
+	SIF,//!< Stress intensification factor.
+	PRESIN,//!< Internal pressure.
+	ANGLE,//!< Angle of elbow.
+	RADCUR,//!< Radius of curvature.
+	UNKNOWN = -99,
+};
+
+/**
+ *  \enum Pattern of transform matrix.
+ */
+enum struct TranPattern {
+	IDENTITY,//!< Identity matrix.
+	BLOCK_DIAGONAL,//!< Block diagonal with 3x3 rotations.
+	DENSE,//!< General dense matrix.
+	UNKNOWN = -99,
+};
+
+/**
+ *  \enum Data requested from element formation, combined as bit mask.
+ */
+enum struct EvalRequest: unsigned {
+	NONE = 0,
+	STIF = 1,//!< Stiffness and transform matrix.
+	MASS = 2,//!< Mass matrix.
+	RHS = 4,//!< Right-hand side vector.
+	ATTR = 8,//!< Basic attribute, such as length, volume and mass.
+	POST = 16,//!< Attribute for stress recovery, such as diameter and SIF.
+	ALL = 31,
+};
+//! Combine requests.
+constexpr EvalRequest operator|(EvalRequest a, EvalRequest b) {
+	return static_cast<EvalRequest>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+//! Remove request b from a.
+constexpr EvalRequest operator-(EvalRequest a, EvalRequest b) {
+	return static_cast<EvalRequest>(static_cast<unsigned>(a) & ~static_cast<unsigned>(b));
+}
+//! Request r is in mask or not.
+constexpr bool has_request(EvalRequest mask, EvalRequest r) {
+	return 0 != (static_cast<unsigned>(mask) & static_cast<unsigned>(r));
+}
+
+/**
+ *  \enum Force and stress quantities of pipe result, combined as bit mask.
+ */
+enum struct PipeResult: unsigned {
+	NONE = 0,
+	FORCE = 1,//!< Member force and moment.
+	SDIR = 2,//!< Direct stress.
+	SBEND = 4,//!< Bending stress.
+	ST = 8,//!< Torsional shear stress.
+	SH = 16,//!< Hoop pressure stress.
+	SSF = 32,//!< Lateral force shear stress.
+	SAXL = 64,//!< Axial stress at circumferential points.
+	SXH = 128,//!< Hoop shear stress at circumferential points.
+	S1 = 256,//!< Maximum principal stress at circumferential points.
+	S2 = 512,//!< Minimum principal stress at circumferential points.
+	SEQV = 1024,//!< Equivalent stress at circumferential points.
+	ALL = 2047,
+};
+//! Combine quantities.
+constexpr PipeResult operator|(PipeResult a, PipeResult b) {
+	return static_cast<PipeResult>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+//! Quantity r is in mask or not.
+constexpr bool has_request(PipeResult mask, PipeResult r) {
+	return 0 != (static_cast<unsigned>(mask) & static_cast<unsigned>(r));
+}
+
 /**
  *  \enum Solution types.
  */
@@ -153,6 +237,8 @@ enum struct SolutionType {
 	MODAL,
 	HARMONIC_FULL,
 	HARMONIC_MODAL_SUPERPOSITION,
+	TRANSIENT,
+	SPECTRUM,
 	UNKNOWN = -99,
 };
 
@@ -177,6 +263,46 @@ enum struct SolutionOption {
 	MODAL_NUMBER,
 	MODAL_FREQ_RANGE,
 	PRESSURE_INTERNAL,
+	KRYLOV_MOMENT,
+	KRYLOV_TOLERANCE,
+	KRYLOV_POINT,
+	TRANSIENT_TIME_STEP,
+	TRANSIENT_HHT_ALPHA,
+	TRANSIENT_OUTPUT_STRIDE,
+	RAYLEIGH_DAMPING,
+	SPECTRUM_DAMPING,
+	SPECTRUM_COMBINATION,
+	SINGLE_PRECISION_KERNEL,
+	RESULT_ENVELOPE,
+};
+
+/**
+ *  \enum Modal combination methods of response spectrum.
+ */
+enum struct ModeCombination {
+	SRSS,//!< Square root of sum of squares.
+	CQC,//!< Complete quadratic combination.
+	GROUPING,//!< Ten percent grouping of closely spaced modes.
+};
+
+/**
+ *  \enum Rules of load combination.
+ */
+enum struct CombinationRule {
+	LINEAR,//!< Algebraic sum of factored terms.
+	SRSS,//!< Square root of sum of squares.
+	ABS,//!< Sum of absolute values.
+	MAX,//!< Maximum of factored terms.
+	MIN,//!< Minimum of factored terms.
+};
+
+/**
+ *  \enum Stress cases of piping code check.
+ */
+enum struct PipeCodeCase {
+	SUSTAINED,//!< Longitudinal stress of sustained loads.
+	OCCASIONAL,//!< Sustained plus occasional loads.
+	EXPANSION,//!< Displacement stress range.
 };
 }  // namespace cafea
 #endif  // CAFEA_ENUM_LIB_HPP_
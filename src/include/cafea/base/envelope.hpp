@@ -0,0 +1,81 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_ENVELOPE_HPP_
+#define CAFEA_ENVELOPE_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+
+namespace cafea {
+/**
+ *  \brief Streaming envelope of results over steps.
+ *
+ *  Each item, such as an element or a node, keeps maximum and minimum of
+ *  each row and the step where they occur. Steps are frequencies or load
+ *  cases fed one block at a time, so history of steps is not stored and
+ *  memory is proportional to number of items. Ties keep the earlier step.
+ *  Different items may be updated by different threads.
+ */
+template <class T = REAL8>
+class Envelope {
+	public:
+		//! Initialize with ids of items and number of rows.
+		void init(const std::vector<int> &id, int num_row);
+		//! Clear variables.
+		void clear() {
+			id_.clear();
+			index_.clear();
+			max_.resize(0, 0);
+			min_.resize(0, 0);
+			max_step_.resize(0, 0);
+			min_step_.resize(0, 0);
+		}
+		//! Update i-th item with values of steps from step0, one column per step.
+		void update(size_t i, int step0, const Eigen::Ref<const matrix_<T>> &val);
+		//! Update i-th item with magnitude of complex values.
+		void update(size_t i, int step0, const Eigen::Ref<const cmatrix_<T>> &val);
+		//! Merge envelope of same items over other steps.
+		void merge(const Envelope &other);
+		//! Get number of items.
+		size_t get_num_item() const { return id_.size();}
+		//! Get number of rows.
+		int get_num_row() const { return static_cast<int>(max_.rows());}
+		//! Get id of i-th item.
+		int get_id(size_t i) const { return id_[i];}
+		//! Get index of item id, -1 when not found.
+		int find(int id) const {
+			auto got = index_.find(id);
+			return got == index_.end() ? -1: static_cast<int>(got->second);
+		}
+		//! Get maximum, one column per item.
+		const matrix_<T>& get_max() const { return max_;}
+		//! Get minimum, one column per item.
+		const matrix_<T>& get_min() const { return min_;}
+		//! Get step of maximum, -1 when not updated.
+		const matrix_<int>& get_max_step() const { return max_step_;}
+		//! Get step of minimum, -1 when not updated.
+		const matrix_<int>& get_min_step() const { return min_step_;}
+
+	private:
+		std::vector<int> id_;//!< Id of items.
+		dict_<size_t> index_;//!< Index of item id.
+		matrix_<T> max_;//!< Maximum.
+		matrix_<T> min_;//!< Minimum.
+		matrix_<int> max_step_;//!< Step of maximum.
+		matrix_<int> min_step_;//!< Step of minimum.
+};
+
+// //!< Specialization.
+template class Envelope<REAL4>;
+template class Envelope<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_ENVELOPE_HPP_
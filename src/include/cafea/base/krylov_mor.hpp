@@ -0,0 +1,95 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_KRYLOV_MOR_HPP_
+#define CAFEA_KRYLOV_MOR_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+
+namespace cafea {
+/**
+ *  \brief Krylov model order reduction for frequency sweep.
+ *
+ *  Multi-point Pade approximation of \f$ [K(1+i\eta)-\omega^2M]x=f \f$.
+ *  Block Arnoldi with moments \f$ (A_0^{-1}M)^k A_0^{-1}F \f$ is generated at
+ *  each expansion frequency, and expansion points are added at the frequency
+ *  of the largest residual until tolerance is reached.
+ */
+template <class T = REAL8>
+class KrylovReducer {
+	public:
+		//! Destructor.
+		virtual ~KrylovReducer() { clear();}
+		//! Load stiffness, mass matrix and structural damping ratio.
+		void load(const Eigen::SparseMatrix<T> &stif, const Eigen::SparseMatrix<T> &mass, T damp = T(0));
+		//! Load right hand side vectors, one column per load case.
+		void set_rhs(const cmatrix_<T> &rhs);
+		//! Add one expansion frequency with number of block moments.
+		bool expand(T freq, int num_moment = 4);
+		//! Adaptive expansion in frequency band.
+		bool reduce(T freq_lb, T freq_ub, T tol = T(1.e-6), int num_moment = 4,
+			int max_point = 8, int num_sample = 64);
+		//! Solve reduced model at frequency for all load cases.
+		cmatrix_<T> solve(T freq) const;
+		//! Solve reduced model at frequency for one load case.
+		vecX_<COMPLEX<T>> solve(T freq, size_t col) const;
+		//! Relative residual of reduced solution in full space.
+		T estimate(T freq) const;
+		//! Clear variables.
+		void clear() {
+			matK_.resize(0, 0);
+			matM_.resize(0, 0);
+			rhs_.resize(0, 0);
+			input_.resize(0, 0);
+			V_.resize(0, 0);
+			KV_.resize(0, 0);
+			MV_.resize(0, 0);
+			Kr_.resize(0, 0);
+			Mr_.resize(0, 0);
+			Fr_.resize(0, 0);
+			points_.clear();
+			damp_ = T(0);
+		}
+		//! Get dimension of reduced model.
+		size_t get_dim() const { return V_.cols();}
+		//! Get dimension of full model.
+		size_t get_full_dim() const { return matK_.rows();}
+		//! Get expansion frequencies.
+		std::vector<T> get_expansion_points() const { return points_;}
+		//! Get projection basis.
+		cmatrix_<T> get_basis() const { return V_;}
+		//! Get reduced stiffness matrix.
+		cmatrix_<T> get_stif() const { return Kr_;}
+		//! Get reduced mass matrix.
+		cmatrix_<T> get_mass() const { return Mr_;}
+
+	private:
+		Eigen::SparseMatrix<COMPLEX<T>> matK_;//!< Complex stiffness with damping.
+		Eigen::SparseMatrix<COMPLEX<T>> matM_;//!< Mass matrix.
+		cmatrix_<T> rhs_;//!< Right hand side of all load cases.
+		cmatrix_<T> input_;//!< Orthonormal input block of rhs_.
+		cmatrix_<T> V_;//!< Orthonormal projection basis.
+		cmatrix_<T> KV_, MV_;//!< Full matrices times basis for residual.
+		cmatrix_<T> Kr_, Mr_, Fr_;//!< Reduced stiffness, mass and rhs.
+		std::vector<T> points_;//!< Expansion frequencies.
+		T damp_{T(0)};//!< Structural damping ratio.
+
+		//! Orthogonalize block against basis and append.
+		size_t append_basis(cmatrix_<T> &W);
+		//! Project full matrices onto basis.
+		void project();
+};
+
+// //!< Specialization.
+template class KrylovReducer<REAL4>;
+template class KrylovReducer<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_KRYLOV_MOR_HPP_
@@ -32,6 +32,10 @@ struct LoadCell {
 	LoadDomain ld_{LoadDomain::TIME};//!< domain of load.
 	//! Value of load.
 	std::variant<T, COMPLEX<T>> val_;
+	//! Get value of load in complex.
+	COMPLEX<T> get_value_cmplx() const {
+		return std::holds_alternative<T>(val_) ? COMPLEX<T>(std::get<T>(val_)): std::get<COMPLEX<T>>(val_);
+	}
 	//! Print info.
 	friend std::ostream& operator<<(std::ostream& cout, const LoadCell &a) {
 		return cout << fmt::format("LoadCell id:{} type:{} dof label:{} domain:{}\n",
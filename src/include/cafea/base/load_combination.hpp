@@ -0,0 +1,75 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_LOAD_COMBINATION_HPP_
+#define CAFEA_LOAD_COMBINATION_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Combination of results of load cases.
+ *
+ *  Results of base load cases are stored one column per case. Each
+ *  combination applies a rule to factored terms, and a term is either a
+ *  load case or an earlier combination, so nested combinations such as
+ *  sustained plus SRSS of seismic directions need no solve. Rules act on
+ *  each row independently, rows are evaluated in parallel blocks and
+ *  columns by array expressions.
+ */
+template <class T = REAL8>
+class LoadCombination {
+	public:
+		//! Factored term of combination.
+		struct Term {
+			int src;//!< Load case i or combination j as num_case+j.
+			T factor;//!< Factor.
+		};
+		//! Initialize with number of load cases.
+		void init(int num_case) {
+			assert(0 < num_case);
+			clear();
+			num_case_ = num_case;
+		}
+		//! Clear variables.
+		void clear() {
+			num_case_ = 0;
+			rule_.clear();
+			ptr_.assign(1, 0);
+			term_.clear();
+		}
+		//! Add combination, return its index.
+		int add(CombinationRule rule, const std::vector<Term> &term);
+		//! Get number of load cases.
+		int get_num_case() const { return num_case_;}
+		//! Get number of combinations.
+		int get_num_combination() const { return static_cast<int>(rule_.size());}
+		//! Get rule of j-th combination.
+		CombinationRule get_rule(int j) const { return rule_[j];}
+		//! Combine results of load cases, one column per case, return one column per combination.
+		matrix_<T> combine(const Eigen::Ref<const matrix_<T>> &basis) const;
+		//! Fill columns of combinations after columns of load cases, each case takes width columns.
+		void evaluate(Eigen::Ref<matrix_<T>> val, int width = 1, bool skip_linear = false) const;
+
+	private:
+		int num_case_{0};//!< Number of load cases.
+		std::vector<CombinationRule> rule_;//!< Rule of combinations.
+		std::vector<size_t> ptr_{0};//!< Offset of terms of combinations.
+		std::vector<Term> term_;//!< Terms of combinations.
+};
+
+// //!< Specialization.
+template class LoadCombination<REAL4>;
+template class LoadCombination<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_LOAD_COMBINATION_HPP_
@@ -82,7 +82,7 @@ class Material: public ObjectBase {
 		std::vector<T> get_material_prop_vec() const;
 		//! Print material info.
 		friend std::ostream& operator<<(std::ostream& cout, const Material &a) {
-			return cout << fmt::format("{} type:{}\n", a.name_,
+			return cout << fmt::format("{} type:{}\n", a.get_name(),
 				a.mtype_ == MaterialType::LINEAR_ELASTIC ? "linear": "unknown");
 		}
 
@@ -0,0 +1,71 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_NODAL_SCATTER_HPP_
+#define CAFEA_NODAL_SCATTER_HPP_
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+
+namespace cafea {
+/**
+ *  \brief Node-to-element map for scatter of element results to nodes.
+ *
+ *  Elements sharing each node are stored in compressed rows, in the order
+ *  of elements given to init(). Each node is written by only one thread
+ *  in for_each_node(), so scatter needs no lock, and the result does not
+ *  depend on number of threads.
+ */
+class NodalScatter {
+	public:
+		//! Share of node by element.
+		struct Share {
+			size_t elem;//!< Index of element.
+			int pos;//!< Position of node in element.
+		};
+		//! Build map from node lists of elements.
+		void init(const std::vector<std::vector<int>> &elem_node);
+		//! Clear variables.
+		void clear() {
+			node_.clear();
+			ptr_.clear();
+			share_.clear();
+			num_elem_ = 0;
+		}
+		//! Get number of nodes.
+		size_t get_num_node() const { return node_.size();}
+		//! Get number of elements.
+		size_t get_num_elem() const { return num_elem_;}
+		//! Get node id of i-th node, in ascending order.
+		int get_node_id(size_t i) const { return node_[i];}
+		//! Get index of node id, -1 when not found.
+		int find(int id) const;
+		//! Get number of elements sharing i-th node.
+		size_t get_num_share(size_t i) const { return ptr_[i+1]-ptr_[i];}
+		//! Get j-th element sharing i-th node.
+		const Share& get_share(size_t i, size_t j) const {
+			assert(j < get_num_share(i));
+			return share_[ptr_[i]+j];
+		}
+		//! Apply function to each element in parallel.
+		template <class F>
+		static void for_each(size_t num, F f) {
+			#pragma omp parallel for schedule(dynamic, 64)
+			for (long i = 0; i < static_cast<long>(num); i++) f(static_cast<size_t>(i));
+		}
+		//! Apply function to each node in parallel.
+		template <class F>
+		void for_each_node(F f) const { for_each(node_.size(), f);}
+
+	private:
+		std::vector<int> node_;//!< Node id in ascending order.
+		std::vector<size_t> ptr_;//!< Offset of shares of each node.
+		std::vector<Share> share_;//!< Shares of nodes.
+		size_t num_elem_{0};//!< Number of elements.
+};
+}  // namespace cafea
+#endif  // CAFEA_NODAL_SCATTER_HPP_
@@ -11,7 +11,6 @@
 #include <string>
 #include <typeinfo>
 #include <typeindex>
-#include <functional>
 #include <type_traits>
 
 #include <Eigen/Dense>
@@ -236,7 +235,7 @@ class NodeBase: public ObjectBase {
 		}
 		//! Print node information.
 		friend std::ostream& operator<<(std::ostream& cout, const NodeBase &a) {
-			cout << a.name_ << "\t";
+			cout << a.get_name() << "\t";
 			switch (a.csys_) {
 				case CoordinateSystem::CARTESIAN:
 					cout << "Cartesian\n";
@@ -295,11 +294,11 @@ class Node: public NodeBase<T> {
 		//! DOF manager init.
 		void dof_init(ElementType et);
 		//! DOF accumulate with default dof type.
-		void dof_accum(int *ij, DofType mt = DofType::NORMAL) { dof_accum_2(ij, mt);}
+		void dof_accum(int *ij, DofType mt = DofType::NORMAL) { dof_mgr_.accum(ij, mt);}
 		//! DOF apply boundary and load.
 		void dof_apply(Boundary<T> bc);
 		//! DOF vector.
-		std::function<std::vector<int>()> dof_list = std::bind(&DofHandler::get_dofs, &dof_mgr_);
+		const std::vector<int>& dof_list() const { return dof_mgr_.get_dofs();}
 		//! Activate node.
 		void activate(bool stat = true) { activate_ = stat;}
 		//! Check status of node.
@@ -333,9 +332,6 @@ class Node: public NodeBase<T> {
 	private:
 		DofHandler dof_mgr_;//!< Dof manager.
 		bool activate_{false};//!< Status of node.
-		//! DOF accumulate bind to dof manager.
-		std::function<void(int*, DofType)> dof_accum_2 = std::bind(&DofHandler::accum,
-			&dof_mgr_, std::placeholders::_1, std::placeholders::_2);
 		vecX_<U> range_;//!< Range of result.
 		matrix_<U> disp_;//!< Storage of displacement.
 		matrix_<U> vel_;//!< Storage of velocity.
@@ -365,6 +361,10 @@ struct NodeFunc {
 	static_assert(std::is_floating_point<U>::value, "NodeFunc<T, U>: U must be floating type.");
 	//! Coordinate transform for 2-node element.
 	static varargout_2_<U> coord_tran(const NodeBase<T>*, const NodeBase<T>*);
+	//! Coordinate transform for 2-node element in fixed-size matrix.
+	static U coord_tran(const NodeBase<T>*, const NodeBase<T>*, mat3_<U>&);
+	//! Coordinate transform for 2-node element in plane of third node.
+	static U coord_tran(const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, mat3_<U>&);
 	//! Coordinate transform for 2-node and up direction.
 	static varargout_2_<U> coord_tran(const NodeBase<T>*, const NodeBase<T>*, const T[]);
 	//! Coordinate transform for 2-node and up direction.
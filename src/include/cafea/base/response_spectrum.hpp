@@ -0,0 +1,93 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_RESPONSE_SPECTRUM_HPP_
+#define CAFEA_RESPONSE_SPECTRUM_HPP_
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Response spectrum combination of modal results.
+ *
+ *  Participation factor \f$ \Gamma_{id}=\phi_i^TMr_d/\phi_i^TM\phi_i \f$ and
+ *  modal coordinate \f$ q_{id}=\Gamma_{id}S_a(f_i)/\omega_i^2 \f$. Peak value
+ *  of each output quantity is \f$ R_d=\sqrt{x^T\rho x} \f$ with
+ *  \f$ x_i=R_iq_{id} \f$, and rows of outputs are combined in blocks by GEMM.
+ */
+template <class T = REAL8>
+class ResponseSpectrum {
+	public:
+		//! Destructor.
+		virtual ~ResponseSpectrum() { clear();}
+		//! Load mode shape, natural frequency in Hz, mass matrix and influence vectors.
+		void load(const matrix_<T> &shape, const vecX_<T> &freq, const Eigen::SparseMatrix<T> &mass,
+			const matrix_<T> &influence, bool is_normalized = true);
+		//! Set acceleration spectrum of direction.
+		void set_spectrum(size_t dir, const vecX_<T> &freq, const vecX_<T> &accel);
+		//! Set modal damping ratio of CQC.
+		void set_damping(T zeta);
+		//! Set modal combination method.
+		void set_method(ModeCombination method);
+		//! Spectral acceleration of direction at frequency.
+		T get_accel(size_t dir, T freq) const;
+		//! Modal coordinates, one column per direction.
+		matrix_<T> get_modal_coord() const;
+		//! Combine response of unit modal coordinates, one column per direction.
+		matrix_<T> combine(const matrix_<T> &resp) const;
+		//! Clear variables.
+		void clear() {
+			freq_.resize(0);
+			mgen_.resize(0);
+			mtot_.resize(0);
+			gamma_.resize(0, 0);
+			meff_.resize(0, 0);
+			rho_.resize(0, 0);
+		}
+		//! Get number of modes.
+		size_t get_num_mode() const { return freq_.size();}
+		//! Get number of directions.
+		size_t get_num_dir() const { return mtot_.size();}
+		//! Get participation factors.
+		const matrix_<T>& get_participation() const { return gamma_;}
+		//! Get effective mass.
+		const matrix_<T>& get_effective_mass() const { return meff_;}
+		//! Get total mass of each direction.
+		const vecX_<T>& get_total_mass() const { return mtot_;}
+		//! Get generalized mass.
+		const vecX_<T>& get_generalized_mass() const { return mgen_;}
+		//! Get modal correlation matrix.
+		const matrix_<T>& get_correlation() const { return rho_;}
+		//! Get modal combination method.
+		ModeCombination get_method() const { return method_;}
+
+	private:
+		vecX_<T> freq_;//!< Natural frequency in Hz.
+		vecX_<T> mgen_;//!< Generalized mass.
+		vecX_<T> mtot_;//!< Total mass of each direction.
+		matrix_<T> gamma_;//!< Participation factors.
+		matrix_<T> meff_;//!< Effective mass.
+		matrix_<T> rho_;//!< Modal correlation matrix.
+		std::vector<std::pair<vecX_<T>, vecX_<T>>> spec_;//!< Frequency and acceleration of spectrum.
+		T zeta_{T(0.05)};//!< Modal damping ratio.
+		ModeCombination method_{ModeCombination::SRSS};//!< Modal combination method.
+
+		//! Update correlation matrix with method, damping and frequency.
+		void init_correlation();
+};
+
+// //!< Specialization.
+template class ResponseSpectrum<REAL4>;
+template class ResponseSpectrum<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_RESPONSE_SPECTRUM_HPP_
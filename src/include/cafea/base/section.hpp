@@ -89,7 +89,7 @@ class Section: public ObjectBase {
 		void set_sect_prop(SectionProp sp, Scalar val);
 		//! Print section info.
 		friend std::ostream& operator<<(std::ostream& cout, const Section &a) {
-			return cout << fmt::format("{} type:{}\n", a.name_,
+			return cout << fmt::format("{} type:{}\n", a.get_name(),
 				static_cast<int>(a.sect_));
 		}
 
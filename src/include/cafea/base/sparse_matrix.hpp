@@ -93,6 +93,7 @@ class SparseMat {
 			format_ = SpFmt::CSC;
 			storge_ = SpStorage::FULL;
 			sym_ = SpSym::SYMMETRIC;
+			with_mass_ = true;
 			if (!row_col_.empty()) row_col_.clear();
 			if (!aux_.empty()) aux_.clear();
 			if (!rhs_.empty()) rhs_.clear();
@@ -109,10 +110,14 @@ class SparseMat {
 		bool is_symmetric() const { return SpSym::SYMMETRIC == sym_;}
 		//! Inquire full storage of matrix.
 		bool is_full() const { return SpStorage::FULL == storge_;}
+		//! Inquire storage of mass values.
+		bool has_mass() const { return with_mass_;}
 		//! Set matrix format.
 		void set_format(SpFmt t) { format_ = t;}
 		//! Set symmetric.
 		void set_symmetric(bool val = true) { if (val) { sym_ = SpSym::SYMMETRIC;}}
+		//! Keep mass values or not, it takes effect in unique.
+		void set_mass(bool val = true) { with_mass_ = val;}
 		//! Add index pair.
 		void append(SparseCell it) { row_col_.push_back(it);}
 		void append(size_t ir, size_t jc) { row_col_.push_back({ir, jc});}
@@ -153,12 +158,16 @@ class SparseMat {
 		SpFmt format_{SpFmt::CSC};//!< Storage method.
 		SpSym sym_{SpSym::SYMMETRIC};//!< Symmetry matrix.
 		SpStorage storge_{SpStorage::FULL};//!< Whole matrix.
+		bool with_mass_{true};//!< Storage of mass values.
 		size_t dim_{0};//!< Dimension of matrix.
 		size_t nnz_{0};//!< Non-zeros of matrix.
 		std::vector<SparseCell> row_col_;//!< Row and column index.
 		std::vector<size_t> aux_;//!< Auxiliary index.
 		std::vector<T> stif_, mass_;//!< Global mass and stiffness values.
 		std::vector<T> rhs_;//!< Global RHS values.
+
+		//! Position of index pair in values.
+		size_t find_index(SparseCell) const;
 };
 // //!< Specialization
 // template class SparseMat<REAL4>;
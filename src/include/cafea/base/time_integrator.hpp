@@ -0,0 +1,89 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_TIME_INTEGRATOR_HPP_
+#define CAFEA_TIME_INTEGRATOR_HPP_
+
+#include <cstddef>
+#include <tuple>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+
+namespace cafea {
+/**
+ *  \brief Implicit Newmark/HHT-alpha time integrator.
+ *
+ *  \f[ Ma_{n+1}+(1+\alpha)(Cv_{n+1}+Ku_{n+1})-\alpha(Cv_n+Ku_n)=(1+\alpha)F_{n+1}-\alpha F_n \f]
+ *  with Rayleigh damping \f$ C=a_0M+a_1K \f$. Effective stiffness is
+ *  factorized once and reused while time step size is unchanged.
+ */
+template <class T = REAL8, class Solver = Eigen::SimplicialLDLT<Eigen::SparseMatrix<T>>>
+class TimeIntegrator {
+	public:
+		//! Destructor.
+		virtual ~TimeIntegrator() { clear();}
+		//! Load K, M and Rayleigh damping coefficients.
+		void load(const Eigen::SparseMatrix<T> &stif, const Eigen::SparseMatrix<T> &mass,
+			T a0 = T(0), T a1 = T(0));
+		//! Set HHT-alpha in [-1/3, 0], beta and gamma follow.
+		void set_hht_alpha(T alpha);
+		//! Set Newmark parameters without numerical dissipation.
+		void set_newmark(T beta = T(0.25), T gamma = T(0.5));
+		//! Set initial state, acceleration from equilibrium.
+		bool init(const vecX_<T> &u0, const vecX_<T> &v0, const vecX_<T> &f0, T t0 = T(0));
+		//! Advance one step with load at the end of step.
+		bool step(T dt, const vecX_<T> &f_next);
+		//! Clear variables.
+		void clear() {
+			K_.resize(0, 0);
+			M_.resize(0, 0);
+			C_.resize(0, 0);
+			Keff_.resize(0, 0);
+			u_.resize(0);
+			v_.resize(0);
+			a_.resize(0);
+			f_.resize(0);
+			dt_ = time_ = T(0);
+			num_fact_ = num_step_ = 0;
+			isFactorized_ = false;
+		}
+		//! Get displacement.
+		const vecX_<T>& get_disp() const { return u_;}
+		//! Get velocity.
+		const vecX_<T>& get_vel() const { return v_;}
+		//! Get acceleration.
+		const vecX_<T>& get_accel() const { return a_;}
+		//! Get current time.
+		T get_time() const { return time_;}
+		//! Get number of steps.
+		size_t get_num_step() const { return num_step_;}
+		//! Get number of factorization.
+		size_t get_num_factorization() const { return num_fact_;}
+		//! Get parameters alpha, beta and gamma.
+		std::tuple<T, T, T> get_parameter() const { return {alpha_, beta_, gamma_};}
+
+	private:
+		Eigen::SparseMatrix<T> K_, M_, C_;//!< Stiffness, mass and damping matrix.
+		Eigen::SparseMatrix<T> Keff_;//!< Effective stiffness matrix.
+		Solver solver_;//!< Solver of effective stiffness.
+		vecX_<T> u_, v_, a_, f_;//!< State and load at current time.
+		T alpha_{T(0)}, beta_{T(0.25)}, gamma_{T(0.5)};//!< Integration parameters.
+		T dt_{T(0)};//!< Time step of factorization.
+		T time_{T(0)};//!< Current time.
+		size_t num_fact_{0}, num_step_{0};//!< Counters.
+		bool isFactorized_{false};//!< Flag of solver status.
+
+		//! Factorize effective stiffness.
+		bool factorize(T dt);
+};
+
+// //!< Specialization.
+template class TimeIntegrator<REAL4>;
+template class TimeIntegrator<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_TIME_INTEGRATOR_HPP_
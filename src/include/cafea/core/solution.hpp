@@ -9,12 +9,16 @@
 
 #include <cstddef>
 #include <array>
+#include <string>
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <complex>
 #include <ostream>
 #include <typeinfo>
 #include <typeindex>
+#include <utility>
+#include <type_traits>
 
 #include <Eigen/Eigen>
 
@@ -28,6 +32,14 @@
 #include "cafea/base/sparse_matrix.hpp"
 #include "cafea/io/mesh_reader.hpp"
 #include "cafea/base/eigenpair.hpp"
+#include "cafea/base/krylov_mor.hpp"
+#include "cafea/base/dof_table.hpp"
+#include "cafea/base/dense_dict.hpp"
+#include "cafea/base/dof_partition.hpp"
+#include "cafea/base/nodal_scatter.hpp"
+#include "cafea/base/envelope.hpp"
+#include "cafea/base/time_integrator.hpp"
+#include "cafea/base/response_spectrum.hpp"
 
 namespace cafea {
 /**
@@ -142,6 +154,21 @@ class SolutionStatic: public SolutionBase <FileReader, Scalar, ResultScalar> {
 		void set_mass_lumped(bool val = false) override {
 			mass_type_ = val ? MassType::LUMPED : MassType::CONSISTENT;
 		}
+		//! Share local matrices of identical elements, and keep them in file for later runs when name is given.
+		void set_element_cache(bool val = true, const char *fn = nullptr) {
+			use_cache_ = val;
+			cache_file_ = nullptr == fn ? "": fn;
+		}
+		//! Get cache of element matrices.
+		const ElementCache<ResultScalar>& get_element_cache() const { return elem_cache_;}
+		//! Evaluate element kernels in single precision, global matrices are assembled in ResultScalar.
+		void set_single_precision(bool val = true) { single_kernel_ = val;}
+		//! Set rows of element result kept by post process.
+		void set_result_request(const ResultRequest &req) { result_req_ = req;}
+		//! Data requested from element formation, global mass is kept only when it is requested.
+		virtual EvalRequest get_eval_request() const {
+			return EvalRequest::STIF | EvalRequest::RHS | EvalRequest::ATTR | EvalRequest::POST;
+		}
 		//!
 		matrix_<ResultScalar> get_node_result(int node_id, LoadType res_tp,
 			int res_span = 0) const override;
@@ -149,10 +176,11 @@ class SolutionStatic: public SolutionBase <FileReader, Scalar, ResultScalar> {
 	protected:
 		FileReader file_parser_;//!< Input file loader.
 
-		dict_<Material<Scalar>> matl_group_;//!< Material dictionary.
-		dict_<Section<Scalar>> sect_group_;//!< Section dictionary.
-		dict_<Node<Scalar, ResultScalar>> node_group_;//!< Node dictionary.
-		dict_<Element<ResultScalar>> elem_group_;//!< Element dictionary.
+		DenseDict<Material<Scalar>> matl_group_;//!< Material dictionary.
+		DenseDict<Section<Scalar>> sect_group_;//!< Section dictionary.
+		DenseDict<Node<Scalar, ResultScalar>> node_group_;//!< Node dictionary.
+		DenseDict<Element<ResultScalar>> elem_group_;//!< Element dictionary.
+		Connectivity conn_;//!< Indices of nodes, material and section of elements.
 
 		std::vector<Boundary<Scalar>> bc_group_;//!< Boundary list.
 
@@ -160,8 +188,183 @@ class SolutionStatic: public SolutionBase <FileReader, Scalar, ResultScalar> {
 
 		MassType mass_type_{MassType::CONSISTENT};
 
+		DofTable dof_table_;//!< Global dofs of nodes.
+		DofPartition dof_part_;//!< Free and prescribed dofs.
+		vecX_<ResultScalar> sol_;//!< Global displacement.
+		std::vector<LoadSet<Scalar>> load_group_;//!< Load list.
+
+		bool use_cache_{false};//!< Use cache of element matrices.
+		std::string cache_file_;//!< File of element cache.
+		ElementCache<ResultScalar> elem_cache_;//!< Local matrices of formed elements.
+		bool single_kernel_{false};//!< Element kernels in single precision.
+		ResultRequest result_req_;//!< Rows of element result.
+
+		//! Pointers to nodes of element, which are passed to kernels without copy.
+		using node_view_ = std::array<const NodeBase<Scalar>*, registered_element_list_::max_num_node()>;
+		//! Form element matrix, with cache when it is enabled.
+		void form_element(Element<ResultScalar> &p_elem, const NodeBase<Scalar>* const pt[],
+			const Material<Scalar> *matl, const Section<Scalar> *sect) {
+			if (use_cache_) {
+				p_elem.template form_matrix<Scalar>(pt, matl, sect, elem_cache_);
+			} else {
+				p_elem.template form_matrix<Scalar>(pt, matl, sect);
+			}
+		}
+		//! Load element cache before assembly.
+		void open_element_cache() {
+			if (!use_cache_) return;
+			elem_cache_.reset_stats();
+			if (!cache_file_.empty() && elem_cache_.load(cache_file_)) {
+				fmt::print("Load element cache: {}\n", cache_file_);
+			}
+		}
+		//! Report and save element cache after assembly.
+		void close_element_cache() {
+			if (!use_cache_) return;
+			elem_cache_.print_stats();
+			if (!cache_file_.empty()) elem_cache_.save(cache_file_);
+		}
+
+		//! Global stiffness or mass matrix in Eigen sparse format.
+		Eigen::SparseMatrix<ResultScalar> get_global_matrix(bool is_mass = false) const {
+			assert(!is_mass || mat_pair_.has_mass());
+			auto dim = mat_pair_.get_dim();
+			auto nnz = mat_pair_.get_nnz();
+			auto val = is_mass ? mat_pair_.get_mass_ptr(): mat_pair_.get_stif_ptr();
+			std::vector<Eigen::Triplet<ResultScalar>> tri_list;
+			tri_list.reserve(nnz);
+			for (size_t i = 0; i < nnz; i++) {
+				const auto &xy = mat_pair_.get_coord_ptr()[i];
+				tri_list.emplace_back(xy.row, xy.col, val[i]);
+			}
+			Eigen::SparseMatrix<ResultScalar> mat(dim, dim);
+			mat.setFromTriplets(tri_list.begin(), tri_list.end());
+			return mat;
+		}
+		//! Add nodal force of load set to global rhs.
+		template <class U>
+		void add_force(LoadSet<Scalar> &p_load, vecX_<U> &rhs) const {
+			for (const auto &x: p_load.get_load_by_type(LoadType::FORCE)) {
+				const int k = dof_table_.get_dof_by_id(x.id_, static_cast<size_t>(x.df_));
+				if (0 <= k) {
+					if constexpr (std::is_floating_point_v<U>) {
+						rhs(k) += U(x.get_value_cmplx().real());
+					} else {
+						rhs(k) += U(x.get_value_cmplx());
+					}
+				}
+			}
+		}
+
+		//! Global index and value of prescribed displacement in load set.
+		std::vector<std::pair<size_t, COMPLEX<ResultScalar>>> get_prescribed(LoadSet<Scalar> &p_load) const {
+			std::vector<std::pair<size_t, COMPLEX<ResultScalar>>> res;
+			for (const auto &x: p_load.get_load_by_type(LoadType::DISP)) {
+				const int k = dof_table_.get_dof_by_id(x.id_, static_cast<size_t>(x.df_));
+				if (0 <= k) res.emplace_back(k, COMPLEX<ResultScalar>(x.get_value_cmplx()));
+			}
+			return res;
+		}
+		//! Prescribed displacement of load set in order of partition.
+		template <class U>
+		vecX_<U> get_prescribed_value(LoadSet<Scalar> &p_load) const {
+			vecX_<U> u_p = vecX_<U>::Zero(dof_part_.get_num_fixed());
+			for (const auto &x: get_prescribed(p_load)) {
+				auto k = dof_part_.get_fixed_index(x.first);
+				if constexpr (std::is_floating_point_v<U>) {
+					u_p(k) = x.second.real();
+				} else {
+					u_p(k) = x.second;
+				}
+			}
+			return u_p;
+		}
+		//! Visit stiffness, mass and rhs of element in global coordinate.
+		template <class F>
+		static void visit_element_matrix(const Element<ResultScalar> &p_elem, F &&fn) {
+			bool done{false};
+			registered_element_list_::visit(p_elem.get_element_type(), [&] (auto tag) {
+				constexpr int N = ElementAttr::get_matrix_dim<decltype(tag)::value>();
+				if constexpr (ElementTraits<decltype(tag)::value>::has_kernel) {
+					if (N != static_cast<int>(p_elem.get_matrix_shape()[0])) return;
+					visit_element_matrix<N>(p_elem, fn);
+					done = true;
+				}
+			});
+			if (done) return;
+			matrix_<ResultScalar> k, m;
+			vecX_<ResultScalar> r;
+			p_elem.get_global_matrix(k, m, r);
+			fn(k, m, r);
+		}
+		//! Visit element matrix in fixed size on stack.
+		template <int N, class F>
+		static void visit_element_matrix(const Element<ResultScalar> &p_elem, F &fn) {
+			matN_<ResultScalar, N> k, m;
+			vecN_<ResultScalar, N> r;
+			p_elem.get_global_matrix(k, m, r);
+			fn(k, m, r);
+		}
+		//! Resolve connectivity of elements once model is loaded.
+		void init_connectivity() { conn_.init(elem_group_, node_group_, matl_group_, sect_group_);}
+		//! Number dofs of nodes and build table of global dofs, return number of equations.
+		int init_dof_table() {
+			int num{0};
+			for (auto &it: node_group_) it.second.dof_accum(&num, DofType::NORMAL);
+			// Nodes have the same index in table and dictionary.
+			dof_table_.clear();
+			dof_table_.reserve(node_group_.size(), 6*node_group_.size());
+			for (const auto &it: node_group_) dof_table_.add(it.first, it.second.dof_list());
+			return num;
+		}
+		//! Dofs of active nodes of e-th element in table, nullptr when node is not found.
+		void get_node_dofs(size_t e, std::vector<const int*> &va) const {
+			const int *node = conn_.get_node(e);
+			va.resize(elem_group_.value(e).get_active_num_of_node());
+			for (size_t i = 0; i < va.size(); i++) {
+				va[i] = 0 > node[i] ? nullptr: dof_table_.get_dofs(static_cast<size_t>(node[i]));
+			}
+		}
+		//! Nodes of e-th element in dictionary, nullptr when node is not found.
+		void get_node_view(size_t e, node_view_ &pt) const {
+			const int *node = conn_.get_node(e);
+			const size_t nn = std::min(conn_.get_num_node(e), pt.size());
+			pt.fill(nullptr);
+			for (size_t i = 0; i < nn; i++) {
+				if (0 <= node[i]) pt[i] = &node_group_.value(static_cast<size_t>(node[i]));
+			}
+		}
+		//! Append sparsity pattern of elements.
+		void init_pattern() {
+			std::vector<const int*> va;
+			for (size_t e = 0; e < elem_group_.size(); e++) {
+				const auto ndof = elem_group_.value(e).get_dofs_per_node();
+				this->get_node_dofs(e, va);
+				for (auto pa: va) {
+					if (nullptr == pa) continue;
+					for (auto pb: va) {
+						if (nullptr == pb) continue;
+						for (size_t ja = 0; ja < ndof; ja++) {
+							if (0 > pa[ja]) continue;
+							for (size_t jb = 0; jb < ndof; jb++) {
+								if (0 <= pb[jb]) mat_pair_.append(pa[ja], pb[jb]);
+							}
+						}
+					}
+				}
+			}
+		}
+		//! Split dofs once by union of prescribed dofs in all load sets.
+		void init_partition(std::vector<LoadSet<Scalar>> &load_list) {
+			std::vector<size_t> fixed;
+			for (auto &p: load_list) {
+				for (const auto &x: get_prescribed(p)) fixed.push_back(x.first);
+			}
+			dof_part_.init(mat_pair_.get_dim(), fixed);
+			fmt::print("Free dofs: {}\tPrescribed dofs: {}\n", dof_part_.get_num_free(), dof_part_.get_num_fixed());
+		}
+
 	private:
-		std::vector<Load<Scalar>> load_group_;//!< Load list.
 		std::unique_ptr<LinearSolver<ResultScalar>> solver_{nullptr};//!< Linear solver for Ax=b.
 		SolutionType sol_type_{SolutionType::STATIC};
 };
@@ -207,6 +410,10 @@ class SolutionModal: public SolutionStatic <FileReader, Scalar, ResultScalar> {
 		void set_parameter(SolutionOption chk, bool val = false) override;
 		//! Get result.
 		matrix_<ResultScalar> get_result() const override { return natural_freq_;}
+		//! Modes need stiffness and mass, attribute is saved in MAT file.
+		EvalRequest get_eval_request() const override {
+			return EvalRequest::STIF | EvalRequest::MASS | EvalRequest::ATTR;
+		}
 
 	protected:
 		matrix_<ResultScalar> mode_shape_;//!< Mode shape of FEA model.
@@ -220,6 +427,62 @@ class SolutionModal: public SolutionStatic <FileReader, Scalar, ResultScalar> {
 };
 
 
+/**
+ *  Solution of response spectrum analysis based on modal results.
+ */
+template <class FileReader, class Scalar = REAL4, class ResultScalar = REAL8>
+class SolutionSpectrum: public SolutionModal <FileReader, Scalar, ResultScalar> {
+	public:
+		//! Default constructor.
+		SolutionSpectrum() {}
+		//! Destructor.
+		~SolutionSpectrum() override {
+			fmt::print("Destructor of response spectrum analysis.\n");
+			spectrum_.clear();
+		}
+		//! Clear variables.
+		void clear() override {
+			SolutionModal<FileReader, Scalar, ResultScalar>::clear();
+			spectrum_.clear();
+		}
+		//! Solve modes and combine peak displacement.
+		void solve() override;
+		//! Combine peak stress of pipe elements.
+		void post_process() override;
+		//! Print information.
+		friend std::ostream& operator<<(std::ostream& cout, const SolutionSpectrum &a) {
+			return cout << "This is solution of response spectrum analysis.\n";
+		}
+		//! Set solve option in numeric values.
+		void set_parameter(SolutionOption chk, init_list_<ResultScalar> val) override;
+		//! Set solve option in boolean values.
+		void set_parameter(SolutionOption chk, bool val = false) override {
+			SolutionModal<FileReader, Scalar, ResultScalar>::set_parameter(chk, val);
+		}
+		//! Get peak result of node.
+		matrix_<ResultScalar> get_node_result(int node_id, LoadType res_tp,
+			int res_span = 0) const override;
+		//! Set acceleration spectrum of global direction 0, 1 or 2.
+		void set_spectrum(size_t dir, const std::vector<ResultScalar> &freq, const std::vector<ResultScalar> &accel) {
+			assert(3 > dir && freq.size() == accel.size());
+			spectrum_.set_spectrum(dir, Eigen::Map<const vecX_<ResultScalar>>(freq.data(), freq.size()),
+				Eigen::Map<const vecX_<ResultScalar>>(accel.data(), accel.size()));
+		}
+		//! Get participation factors and effective mass.
+		const ResponseSpectrum<ResultScalar>& get_spectrum() const { return spectrum_;}
+		//! Peak stress needs attribute of section.
+		EvalRequest get_eval_request() const override {
+			return SolutionModal<FileReader, Scalar, ResultScalar>::get_eval_request() | EvalRequest::POST;
+		}
+
+	private:
+		ResponseSpectrum<ResultScalar> spectrum_;//!< Modal combination.
+		SolutionType sol_type_{SolutionType::SPECTRUM};
+
+		//! Global dofs of active nodes of element.
+		std::vector<int> get_dofs(const Element<ResultScalar> &p_elem) const;
+};
+
 /**
  *  Solution of harmonic
  */
@@ -264,16 +527,131 @@ class SolutionHarmonicFull: public SolutionStatic <FileReader, Scalar, ResultSca
 		//! Get result.
 		matrix_<ResultScalar> get_node_result(int node_id, LoadType res_tp,
 			int res_span = 0) const override;
+		//! Element rhs is only used by pressure load.
+		EvalRequest get_eval_request() const override {
+			auto req = EvalRequest::STIF | EvalRequest::MASS | EvalRequest::ATTR | EvalRequest::POST;
+			return has_pressure_ ? req | EvalRequest::RHS: req;
+		}
+		//! Keep only envelopes over frequencies in post process, instead of results of each frequency.
+		void set_envelope_only(bool val = true) { envelope_only_ = val;}
+		//! Get envelope of element results, rows of each active node are stacked.
+		const Envelope<ResultScalar>& get_element_envelope() const { return elem_env_;}
+		//! Get envelope of nodal results, rows follow result request.
+		const Envelope<ResultScalar>& get_node_envelope() const { return node_env_;}
 
-	private:
+	protected:
 		bool has_pressure_{false};
+		bool envelope_only_{false};//!< Keep envelopes only.
+		Envelope<ResultScalar> elem_env_;//!< Envelope of element results over frequencies.
+		Envelope<ResultScalar> node_env_;//!< Envelope of nodal results over frequencies.
 		vecX_<ResultScalar> damping_;
 		vecX_<ResultScalar> freq_range_;
-		std::vector<LoadSet<Scalar>> load_group_;
 
 		matrix_<COMPLEX<ResultScalar>> disp_cmplx_;
 		matrix_<COMPLEX<ResultScalar>> rhs_cmplx_;
 		SolutionType sol_type_{SolutionType::HARMONIC_FULL};
+
+		//! Write nodal displacement from disp_cmplx_.
+		void set_node_disp();
+		//! Post process keeping envelopes only.
+		void post_envelope(const std::vector<Element<ResultScalar>*> &elem_list,
+			std::vector<std::vector<int>> elem_node);
+};
+
+/**
+ *  Solution of harmonic via Krylov model order reduction.
+ */
+template <class FileReader, class Scalar = REAL4, class ResultScalar = REAL8>
+class SolutionHarmonicKrylov: public SolutionHarmonicFull <FileReader, Scalar, ResultScalar> {
+	public:
+		//! Default constructor.
+		SolutionHarmonicKrylov() {}
+		//! Destructor.
+		~SolutionHarmonicKrylov() override {
+			fmt::print("Destructor of harmonic analysis via Krylov reduction.\n");
+			reducer_.clear();
+		}
+		//! Solve.
+		void solve() override;
+		//! Print information.
+		friend std::ostream& operator<<(std::ostream& cout, const SolutionHarmonicKrylov &a) {
+			return cout << "This is solution of harmonic analysis via Krylov reduction.\n";
+		}
+		//! Set solve option in numeric values.
+		void set_parameter(SolutionOption chk, init_list_<ResultScalar> val) override;
+		//! Set solve option in boolean values.
+		void set_parameter(SolutionOption chk, bool val = false) override {
+			SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::set_parameter(chk, val);
+		}
+		//! Get reduced model.
+		const KrylovReducer<ResultScalar>& get_reducer() const { return reducer_;}
+
+	private:
+		int num_moment_{4};//!< Block moments per expansion point.
+		int max_point_{8};//!< Maximum number of expansion points.
+		ResultScalar tol_{ResultScalar(1.e-6)};//!< Tolerance of relative residual.
+		KrylovReducer<ResultScalar> reducer_;//!< Reduced order model.
+};
+
+/**
+ *  Solution of transient analysis.
+ */
+template <class FileReader, class Scalar = REAL4, class ResultScalar = REAL8>
+class SolutionTransient: public SolutionStatic <FileReader, Scalar, ResultScalar> {
+	public:
+		//! Default constructor.
+		SolutionTransient() {}
+		//! Destructor.
+		~SolutionTransient() override {
+			fmt::print("Destructor of transient analysis.\n");
+			clear();
+		}
+		//! Initialize environment.
+		void init() override;
+		//! Clear variables.
+		void clear() override;
+		//! Solve.
+		void solve() override;
+		//! Post process.
+		void post_process() override;
+		//! Print information.
+		friend std::ostream& operator<<(std::ostream& cout, const SolutionTransient &a) {
+			return cout << "This is solution of transient analysis.\n";
+		}
+		//! Set solve option in numeric values.
+		void set_parameter(SolutionOption chk, init_list_<ResultScalar> val) override;
+		//! Set solve option in boolean values.
+		void set_parameter(SolutionOption chk, bool val = false) override;
+		//! Get node result at the last step.
+		matrix_<ResultScalar> get_node_result(int node_id, LoadType res_tp,
+			int res_span = 0) const override;
+		//! Mass is needed by time integration.
+		EvalRequest get_eval_request() const override {
+			return SolutionStatic<FileReader, Scalar, ResultScalar>::get_eval_request() | EvalRequest::MASS;
+		}
+		//! Add load set in time domain, value of load set is time.
+		void add_load(const LoadSet<Scalar> &p) { this->load_group_.push_back(p);}
+		//! Set result file and output stride.
+		void set_output(const char* fn, int stride = 1) {
+			output_ = fn;
+			stride_ = std::max(1, stride);
+		}
+
+	private:
+		ResultScalar dt_{ResultScalar(1.e-3)};//!< Time step.
+		int num_step_{0};//!< Number of time steps.
+		int stride_{1};//!< Output every stride steps.
+		ResultScalar alpha_{ResultScalar(0)};//!< HHT-alpha parameter.
+		ResultScalar rayleigh_[2]={ResultScalar(0), ResultScalar(0)};//!< Rayleigh damping.
+		std::string output_{"transient.bin"};//!< Result file.
+		std::unique_ptr<TimeIntegrator<ResultScalar>> solver_{nullptr};//!< Time integrator.
+		SolutionType sol_type_{SolutionType::TRANSIENT};
+
+		//! Global force and prescribed displacement of load sets, sorted by time.
+		std::vector<ResultScalar> load_time_;
+		std::vector<vecX_<ResultScalar>> load_force_, load_disp_;
+		//! Interpolate load and prescribed displacement at time.
+		void get_load(ResultScalar t, vecX_<ResultScalar> &f, vecX_<ResultScalar> &u_p) const;
 };
 // //! Specialization with float type.
 // template class SolutionStatic<AnsysCdbReader<REAL4>, REAL4, REAL8>;
@@ -0,0 +1,113 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_CODE_CHECK_HPP_
+#define CAFEA_CODE_CHECK_HPP_
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+#include <Eigen/Eigen>
+
+#include "cafea/utils/utils.hpp"
+#include "cafea/element/element_attr.hpp"
+
+namespace cafea {
+/**
+ *  \brief Stress check of pipe elements by ASME B31.1.
+ *
+ *  Section data and allowables of elements are gathered into structure of
+ *  arrays, and the resultant moment of each element and load combination is
+ *  kept in one table. Each check is then one array expression over all
+ *  elements, and checks are evaluated in parallel.
+ *  - Sustained, eq. (15): \f$ S_L=PD_o/4t_n+0.75iM_A/Z\le S_h \f$.
+ *  - Occasional, eq. (16): \f$ PD_o/4t_n+0.75i(M_A+M_B)/Z\le kS_h \f$.
+ *  - Expansion, eq. (17): \f$ S_E=iM_C/Z\le f(1.25S_c+0.25S_h)+f(S_h-S_L) \f$,
+ *    the last term only when the sustained combination is given.
+ *
+ *  Here \f$ 0.75i \f$ is not less than 1, and moments are the larger of both ends.
+ */
+template <class T = REAL8>
+class PipeCodeCheck {
+	static_assert(std::is_floating_point<T>::value, "PipeCodeCheck<T>: T must be floating type.");
+	public:
+		//! Check of combination.
+		struct Check {
+			PipeCodeCase type;//!< Stress case.
+			int comb;//!< Combination of loads, occasional loads for OCCASIONAL.
+			int sustained;//!< Sustained combination, -1 when not used.
+		};
+		//! Reserve number of elements.
+		void reserve(size_t n);
+		//! Append an element with hot and cold allowable stress.
+		void add(int id, const ElementProperty<T> &attr, T sh, T sc);
+		//! Set stress range reduction factor and occasional load factor.
+		void set_factor(T f, T k) {
+			f_ = f;
+			k_ = k;
+		}
+		//! Add check, return its index.
+		int add_check(PipeCodeCase type, int comb, int sustained = -1);
+		//! Reset moments of combinations to zero.
+		void init_moment(int num_comb);
+		//! Set moments of element from member force of combinations.
+		void set_moment(size_t i, const Eigen::Ref<const matrix_<T>> &force);
+		//! Evaluate all checks.
+		void evaluate();
+		//! Number of elements.
+		size_t size() const { return id_.size();}
+		//! Number of checks.
+		int get_num_check() const { return static_cast<int>(check_.size());}
+		//! Get id of i-th element.
+		int get_id(size_t i) const { return id_[i];}
+		//! Get j-th check.
+		const Check& get_check(int j) const { return check_[j];}
+		//! Get resultant moments, one column per combination.
+		const matrix_<T>& get_moment() const { return mom_;}
+		//! Get code stresses, one column per check.
+		const matrix_<T>& get_stress() const { return stress_;}
+		//! Get allowable stresses, one column per check.
+		const matrix_<T>& get_allowable() const { return allow_;}
+		//! Get ratios of stress to allowable, one column per check.
+		matrix_<T> get_ratio() const { return (stress_.array()/allow_.array()).matrix();}
+		//! All checks of i-th element pass or not.
+		bool is_pass(size_t i) const;
+		//! Number of elements failed in j-th check.
+		size_t get_num_fail(int j) const;
+		//! Maximum ratio of j-th check, and index of element.
+		T get_max_ratio(int j, size_t *elem = nullptr) const;
+		//! Print one line of utilization per check.
+		void print_summary() const;
+		//! Clear variables.
+		void clear() {
+			for (auto &it: in_) it.clear();
+			id_.clear();
+			check_.clear();
+			mom_.resize(0, 0);
+			stress_.resize(0, 0);
+			allow_.resize(0, 0);
+		}
+
+	private:
+		//! Input fields.
+		enum { ZS, SIF, PL, SH, SC, NUM_IN};
+		std::array<std::vector<T>, NUM_IN> in_;//!< Section modulus, SIF, pressure stress and allowables.
+		std::vector<int> id_;//!< Id of elements.
+		std::vector<Check> check_;//!< Checks.
+		T f_{T(1)};//!< Stress range reduction factor.
+		T k_{T(1.15)};//!< Occasional load factor.
+		matrix_<T> mom_;//!< Resultant moment of elements and combinations.
+		matrix_<T> stress_;//!< Code stress of elements and checks.
+		matrix_<T> allow_;//!< Allowable stress of elements and checks.
+};
+
+// //!< Specialization.
+template class PipeCodeCheck<REAL4>;
+template class PipeCodeCheck<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_CODE_CHECK_HPP_
@@ -7,23 +7,182 @@
 #ifndef CAFEA_ELEMENT_ATTR_HPP_
 #define CAFEA_ELEMENT_ATTR_HPP_
 
+#include <map>
+#include <array>
+#include <string>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <initializer_list>
 
 #include "cafea/base/enum_lib.hpp"
+#include "cafea/element/element_registry.hpp"
 
 namespace cafea {
 /**
  *  \brief Attribution of element.
+ *
+ *  Attributes are looked up in ElementTraits of registered element types.
  */
 struct ElementAttr {
     //! Get dofs per node.
-	static size_t get_dofs_per_node(ElementType);
+	static constexpr size_t get_dofs_per_node(ElementType);
 	//! Get activated number of nodes.
-	static size_t get_active_num_of_node(ElementType);
+	static constexpr size_t get_active_num_of_node(ElementType);
+	//! Get total number of nodes.
+	static constexpr size_t get_num_of_node(ElementType);
+	//! Element matrix is available or not.
+	static constexpr bool has_kernel(ElementType);
+	//! Stress post process is available or not.
+	static constexpr bool has_stress(ElementType);
+	//! Get dimension of element matrix at compile time.
+	template <ElementType ET>
+	static constexpr int get_matrix_dim() { return ElementTraits<ET>::matrix_dim();}
 	//! Get shape function order.
 	static size_t get_element_order(ElementType);
 	//! Get element type in Ansys rules.
 	static size_t get_element_type_id(ElementType);
+	//! Get element type from id in Ansys rules.
+	static ElementType get_element_type(size_t);
 };
+/**
+ *  \brief Get dofs on each node.
+ *  \return number of dofs on a node.
+ */
+constexpr size_t ElementAttr::get_dofs_per_node(ElementType et) {
+	size_t res{0};
+	registered_element_list_::visit(et, [&res] (auto tag) { res = ElementTraits<decltype(tag)::value>::dofs_per_node;});
+	return res;
+}
+/**
+ *  \brief Get number of active node.
+ *  \return number of active node.
+ */
+constexpr size_t ElementAttr::get_active_num_of_node(ElementType et) {
+	size_t res{0};
+	registered_element_list_::visit(et, [&res] (auto tag) { res = ElementTraits<decltype(tag)::value>::num_active_node;});
+	return res;
+}
+/**
+ *  \brief Get total number of node.
+ *  \return number of node including orientation node.
+ */
+constexpr size_t ElementAttr::get_num_of_node(ElementType et) {
+	size_t res{0};
+	registered_element_list_::visit(et, [&res] (auto tag) { res = ElementTraits<decltype(tag)::value>::num_node;});
+	return res;
+}
+/**
+ *  \brief Element matrix is available or not.
+ */
+constexpr bool ElementAttr::has_kernel(ElementType et) {
+	bool res{false};
+	registered_element_list_::visit(et, [&res] (auto tag) { res = ElementTraits<decltype(tag)::value>::has_kernel;});
+	return res;
+}
+/**
+ *  \brief Stress post process is available or not.
+ */
+constexpr bool ElementAttr::has_stress(ElementType et) {
+	bool res{false};
+	registered_element_list_::visit(et, [&res] (auto tag) { res = ElementTraits<decltype(tag)::value>::has_stress;});
+	return res;
+}
+/**
+ *  \brief Property record of element indexed by ElementProp.
+ *
+ *  Values are kept in fixed layout with a mask of assigned properties,
+ *  names are only used when properties are exported.
+ */
+template <class T>
+class ElementProperty {
+	public:
+		//! Number of properties.
+		static constexpr size_t size() { return static_cast<size_t>(ElementProp::RADCUR)+1;}
+		//! Name of property.
+		static constexpr const char* get_name(ElementProp);
+		//! Get property, or default value when it is not assigned.
+		T get(ElementProp p, T val = T(0)) const { return has(p) ? val_[index(p)]: val;}
+		//! Set property.
+		void set(ElementProp p, T val) {
+			val_[index(p)] = val;
+			mask_ |= uint32_t(1) << index(p);
+		}
+		//! Set list of properties.
+		void set(std::initializer_list<std::pair<ElementProp, T>> val) {
+			for (const auto &it: val) set(it.first, it.second);
+		}
+		//! Clear and set list of properties.
+		void assign(std::initializer_list<std::pair<ElementProp, T>> val) {
+			clear();
+			set(val);
+		}
+		//! Property is assigned or not.
+		bool has(ElementProp p) const { return 0 != (mask_ & (uint32_t(1) << index(p)));}
+		//! None property is assigned.
+		bool empty() const { return 0 == mask_;}
+		//! Clear properties.
+		void clear() {
+			val_.fill(T(0));
+			mask_ = 0;
+		}
+		//! String keyed view of assigned properties for export.
+		std::map<std::string, T> to_map() const {
+			std::map<std::string, T> res;
+			for (size_t i = 0; i < size(); i++) {
+				auto p = static_cast<ElementProp>(i);
+				if (has(p)) res[get_name(p)] = val_[i];
+			}
+			return res;
+		}
+		//! Compare assigned properties.
+		bool operator==(const ElementProperty &b) const { return mask_ == b.mask_ && val_ == b.val_;}
+		//! Properties in another floating type.
+		template <class S>
+		ElementProperty<S> cast() const {
+			ElementProperty<S> res;
+			for (size_t i = 0; i < size(); i++) {
+				if (0 != (mask_ & (uint32_t(1) << i))) res.set(static_cast<ElementProp>(i), static_cast<S>(val_[i]));
+			}
+			return res;
+		}
+
+	private:
+		std::array<T, size()> val_{};//!< Value of properties.
+		uint32_t mask_{0};//!< Mask of assigned properties.
+
+		//! Index of property.
+		static constexpr size_t index(ElementProp p) {
+			assert(0 <= static_cast<int>(p) && static_cast<size_t>(p) < size());
+			return static_cast<size_t>(p);
+		}
+};
+/**
+ *  \brief Get name of property.
+ *  \return name of property, same as the keys of former attribute map.
+ */
+template <class T>
+constexpr const char* ElementProperty<T>::get_name(ElementProp p) {
+	switch (p) {
+		case ElementProp::LENGTH: return "Length";
+		case ElementProp::AREA:   return "Area";
+		case ElementProp::VOLUME: return "Volume";
+		case ElementProp::MASS:   return "Mass";
+		case ElementProp::AW:     return "Aw";
+		case ElementProp::THICK:  return "Thick";
+		case ElementProp::OD:     return "OuterDiameter";
+		case ElementProp::ID:     return "InnerDiameter";
+		case ElementProp::IY:     return "Iy";
+		case ElementProp::IZ:     return "Iz";
+		case ElementProp::JX:     return "Jx";
+		case ElementProp::SIF:    return "StressIntensificationFactor";
+		case ElementProp::PRESIN: return "InternalPressure";
+		case ElementProp::ANGLE:  return "Angle";
+		case ElementProp::RADCUR: return "CurvatureRadius";
+		case ElementProp::UNKNOWN:
+		default:                  return "Unknown";
+	}
+}
 }  // namespace cafea
 #endif  // CAFEA_ELEMENT_ATTR_HPP_
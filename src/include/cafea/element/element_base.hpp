@@ -17,7 +17,10 @@
 #include "cafea/base/load.hpp"
 #include "cafea/base/section.hpp"
 #include "cafea/base/material.hpp"
+#include "cafea/base/block_tran.hpp"
 #include "cafea/element/element_lib.hpp"
+#include "cafea/element/pipe_batch.hpp"
+#include "cafea/element/element_cache.hpp"
 // #include "cafea/fortran/fortran_wrapper.hpp"
 
 namespace cafea {
@@ -89,24 +92,56 @@ class Element: public ObjectBase {
 		//! Generate stiffness mass matrix of element.
 		template <class U = REAL4>
 		void form_matrix(const Node<U, T>[], const Material<U>*, const Section<U>*);
+		//! Generate stiffness mass matrix of element from pointers to nodes.
+		template <class U = REAL4>
+		void form_matrix(const NodeBase<U>* const[], const Material<U>*, const Section<U>*);
+
+		template <class U = REAL4>
+		void form_matrix(const std::vector<Node<U, T>>&, const Material<U>*, const Section<U>*);
 
 		template <class U = REAL4>
-		void form_matrix(const std::vector<Node<U, T>>, const Material<U>*, const Section<U>*);
+		void form_matrix(const Node<U, T>[], const Material<U>*, const Section<U>*, const std::vector<LoadCell<U>>&);
 
 		template <class U = REAL4>
-		void form_matrix(const Node<U, T>[], const Material<U>*, const Section<U>*, const std::vector<LoadCell<U>>);
+		void form_matrix(const NodeBase<U>* const[], const Material<U>*, const Section<U>*, const std::vector<LoadCell<U>>&);
 
 		template <class U = REAL4>
-		void form_matrix(const std::vector<Node<U, T>>, const Material<U>*, const Section<U>*, const std::vector<LoadCell<U>>);
+		void form_matrix(const std::vector<Node<U, T>>&, const Material<U>*, const Section<U>*, const std::vector<LoadCell<U>>&);
+		//! Load element matrix from batched evaluation.
+		template <class U = REAL4>
+		void form_matrix(const PipeBatch<U, T>&, size_t);
+		//! Generate element matrix with cache of local matrices.
+		template <class U = REAL4>
+		void form_matrix(const Node<U, T>[], const Material<U>*, const Section<U>*, ElementCache<T>&);
+		//! Generate element matrix with cache of local matrices from pointers to nodes.
+		template <class U = REAL4>
+		void form_matrix(const NodeBase<U>* const[], const Material<U>*, const Section<U>*, ElementCache<T>&);
 
 		//! Get stiffness matrix.
-		matrix_<T> get_stif() const { return stif_;}
+		const matrix_<T>& get_stif() const { return stif_;}
 		//! Get mass matrix.
-		matrix_<T> get_mass() const { return mass_;}
+		const matrix_<T>& get_mass() const { return mass_;}
 		//! Get transpose matrix.
-		matrix_<T> get_tran() const { return tran_;}
+		const matrix_<T>& get_tran() const { return tran_;}
 		//! Get right-hand side matrix.
-		vecX_<T> get_rhs() const { return rhs_;}
+		const vecX_<T>& get_rhs() const { return rhs_;}
+		//! Get property of element.
+		const ElementProperty<T>& get_property() const { return attr_;}
+		//! Get pattern of transform matrix.
+		TranPattern get_tran_pattern() const { return tran_pat_;}
+		//! Get stiffness, mass and rhs in global coordinate with fixed size, mass and rhs not requested are zero.
+		template <int N>
+		void get_global_matrix(matN_<T, N> &stif, matN_<T, N> &mass, vecN_<T, N> &rhs) const {
+			assert(N == stif_.rows() && N == tran_.rows());
+			BlockTran<T>::transform(tran_, tran_pat_, stif_, mass_, rhs_, stif, mass, rhs);
+		}
+		//! Get stiffness, mass and rhs in global coordinate, mass and rhs not requested are empty.
+		void get_global_matrix(matrix_<T> &stif, matrix_<T> &mass, vecX_<T> &rhs) const {
+			stif.resize(stif_.rows(), stif_.cols());
+			mass.resize(mass_.rows(), mass_.cols());
+			rhs.resize(rhs_.size());
+			BlockTran<T>::transform(tran_, tran_pat_, stif_, mass_, rhs_, stif, mass, rhs);
+		}
 		//!
 		template <class ResType = T>
 		matrix_<ResType> get_rhs() const;
@@ -116,7 +151,9 @@ class Element: public ObjectBase {
 		template <class ResType = T>
 		matrix_<ResType> get_result() const;
 		//!
-		cmatrix_<T> get_rhs_cmplx() const { return rhs_cmplx_;}
+		const cmatrix_<T>& get_rhs_cmplx() const { return rhs_cmplx_;}
+		//! Get reference of result matrix in complex.
+		const cmatrix_<T>& get_result_cmplx() const { return result_cmplx_;}
 
 		//! Get raw pointer of stiffness matrix.
 		const T* get_stif_ptr() const { return stif_.data();}
@@ -136,6 +173,15 @@ class Element: public ObjectBase {
 		void post_stress(const matrix_<ResType>);
 		// void post_stress(const matrix_<T>);
 		// void post_stress(const matrix_<std::complex<T>>);
+		//! Member force of multiple displacements in local coordinate.
+		matrix_<T> get_member_force(const matrix_<T> x) const;
+		//! Post process with peak member force.
+		void post_stress_peak(const matrix_<T> force);
+		//! Release result matrices.
+		void clear_result() {
+			result_.resize(0, 0);
+			result_cmplx_.resize(0, 0);
+		}
 
 		//! Set node list.
 		void set_node_list(const int a[], int m) {
@@ -177,13 +223,19 @@ class Element: public ObjectBase {
 		}
 		//! Set mass matrix format.
 		void set_lumped_mass(bool val = false) { if (val) { keyopt_[0] = 1;}}
+		//! Evaluate kernel in single precision, matrices are still kept in T.
+		void set_single_precision(bool val = true) { single_ = val;}
+		//! Set data requested from element formation, stiffness is always formed.
+		void set_eval_request(EvalRequest req) { eval_req_ = req | EvalRequest::STIF;}
+		//! Set rows of result kept by post process.
+		void set_result_request(const ResultRequest &req) { result_req_ = req;}
 
 		//! Get material id.
 		int get_material_id() const { return matl_;}
 		//! Get section id.
 		int get_section_id() const { return sect_;}
 		//! Get node list.
-		std::vector<int> get_node_list() const { return nodes_;}
+		const std::vector<int>& get_node_list() const { return nodes_;}
 		//! Get option.
 		std::array<int, 10> get_option() const { return keyopt_;}
 		//! Get type of element.
@@ -207,9 +259,15 @@ class Element: public ObjectBase {
 		//! Get shape of result matrix.
 		std::array<size_t, 2> get_result_shape() const;
 		//! Get global dofs array.
-		std::vector<int> get_element_dofs() const { return global_dofs_;}
+		const std::vector<int>& get_element_dofs() const { return global_dofs_;}
 		//! Get mass format.
 		bool is_lumped_mass() const { return 0 < keyopt_[0];}
+		//! Get data requested from element formation.
+		EvalRequest get_eval_request() const { return eval_req_;}
+		//! Kernel is evaluated in single precision or not.
+		bool is_single_precision() const { return single_;}
+		//! Get rows of result kept by post process.
+		const ResultRequest& get_result_request() const { return result_req_;}
 		//! Print information.
 		friend std::ostream& operator<<(std::ostream& cout, const Element &a) {
 			cout << fmt::format("Element id:{}\t", a.id_);
@@ -227,7 +285,11 @@ class Element: public ObjectBase {
 		std::array<int, 10> keyopt_{0, 0, 0, 0, 0, 0, 0, 0, 0, 0};//!< Parameters of element.
 		std::vector<int> nodes_;//!< Array of node list.
 		std::vector<int> global_dofs_;//!< Array of global dofs.
-		std::map<std::string, T> attr_;//!< Attribute of element parameters.
+		ElementProperty<T> attr_;//!< Property of element parameters.
+		TranPattern tran_pat_{TranPattern::DENSE};//!< Pattern of transform matrix.
+		EvalRequest eval_req_{EvalRequest::ALL};//!< Data requested from element formation.
+		bool single_{false};//!< Kernel in single precision.
+		ResultRequest result_req_;//!< Rows of result.
 
 		matrix_<T> stif_;//!< Stiffness matrix of element.
 		matrix_<T> mass_;//!< Mass matrix of element.
@@ -238,6 +300,50 @@ class Element: public ObjectBase {
 		cmatrix_<T> rhs_cmplx_;//!< Right-hand matrix of element in complex.
 		cmatrix_<T> load_cmplx_;//!< Load matrix of element in complex.
 		cmatrix_<T> result_cmplx_;//!< Result of element in complex.
+
+		//! Pointers to nodes of array, which are enough for element type.
+		template <class U>
+		void node_view(const Node<U, T> p[], const NodeBase<U>* pt[]) const {
+			const size_t nn = ElementAttr::get_num_of_node(etype_);
+			assert(nn <= registered_element_list_::max_num_node());
+			for (size_t i = 0; i < nn; i++) pt[i] = &p[i];
+		}
+		//! Keep fixed-size kernel, storage is reused when size is unchanged.
+		//! Mass and rhs not requested are released, kernel in other precision is converted to T.
+		template <class S, int N>
+		void set_kernel(const ElementKernel<S, N> &ke) {
+			stif_ = ke.stif.template cast<T>();
+			tran_ = ke.tran.template cast<T>();
+			if (has_request(eval_req_, EvalRequest::MASS)) {
+				mass_ = ke.mass.template cast<T>();
+			} else {
+				mass_.resize(0, 0);
+			}
+			if (has_request(eval_req_, EvalRequest::RHS)) {
+				rhs_ = ke.rhs.template cast<T>();
+			} else {
+				rhs_.resize(0);
+			}
+			tran_pat_ = BlockTran<T>::get_pattern(tran_);
+		}
+		//! Keep local matrices of cache and rotation of element.
+		void set_kernel(const typename ElementCache<T>::Entry &val, const mat3_<T> &tt) {
+			stif_ = val.stif;
+			if (has_request(eval_req_, EvalRequest::MASS)) {
+				mass_ = val.mass;
+			} else {
+				mass_.resize(0, 0);
+			}
+			if (has_request(eval_req_, EvalRequest::RHS)) {
+				rhs_ = val.rhs;
+			} else {
+				rhs_.resize(0);
+			}
+			attr_ = val.attr;
+			tran_.setZero(stif_.rows(), stif_.cols());
+			for (int i: {0, 1, 2, 3}) tran_.block(i*3, i*3, 3, 3) = tt;
+			tran_pat_ = BlockTran<T>::get_pattern(tran_);
+		}
 };
 
 // #include "element_ext.hpp"
@@ -0,0 +1,118 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_ELEMENT_CACHE_HPP_
+#define CAFEA_ELEMENT_CACHE_HPP_
+
+#include <array>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+
+#include "cafea/element/element_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Cache of element matrices in local coordinate.
+ *
+ *  Straight pipes of same length and elbows of same chord share stiffness,
+ *  mass and rhs in local coordinate when material, section and options are
+ *  the same, only transform matrix differs. Entries are keyed by element
+ *  type, material id, section id, options and geometry rounded by tolerance.
+ *  The cache is valid for one model, and it can be saved for later runs of
+ *  the same model.
+ */
+template <class T = REAL8>
+class ElementCache {
+	static_assert(std::is_floating_point<T>::value, "ElementCache<T>: T must be floating type.");
+	public:
+		//! Key of element.
+		struct Key {
+			ElementType etype_{ElementType::UNKNOWN};//!< Type of element.
+			int matl_{-1};//!< Material id.
+			int sect_{-1};//!< Section id.
+			std::array<int, 10> keyopt_{};//!< Options of element.
+			int64_t geom_{0};//!< Rounded geometry of element.
+			//! Compare keys.
+			bool operator==(const Key &b) const {
+				return etype_ == b.etype_ && matl_ == b.matl_ && sect_ == b.sect_ &&
+					keyopt_ == b.keyopt_ && geom_ == b.geom_;
+			}
+		};
+		//! Hash of key.
+		struct KeyHash {
+			size_t operator()(const Key&) const;
+		};
+		//! Element matrices in local coordinate.
+		struct Entry {
+			matN_<T, 12> stif;//!< Stiffness matrix.
+			matN_<T, 12> mass;//!< Mass matrix.
+			vecN_<T, 12> rhs;//!< Right-hand side vector.
+			ElementProperty<T> attr;//!< Property of element.
+		};
+
+		//! Element type is cached or not.
+		static constexpr bool is_cached(ElementType et) {
+			return ElementType::PIPE16 == et || ElementType::PIPE18 == et;
+		}
+		//! Key of element.
+		Key make_key(ElementType, int, int, const std::array<int, 10>&, T) const;
+		//! Find entry and count hit or miss.
+		const Entry* find(const Key&);
+		//! Insert entry.
+		const Entry* insert(const Key&, const Entry&);
+		//! Save entries to binary file.
+		bool save(const std::string&) const;
+		//! Load entries from binary file.
+		bool load(const std::string&);
+		//! Print statistics.
+		void print_stats() const;
+
+		//! Set tolerance of geometry, entries are cleared.
+		void set_tolerance(T val) {
+			assert(EPS<T>() < val);
+			tol_ = val;
+			this->clear();
+		}
+		//! Get tolerance of geometry.
+		T get_tolerance() const { return tol_;}
+		//! Number of entries.
+		size_t size() const { return dict_.size();}
+		//! Number of hits.
+		size_t get_num_hit() const { return num_hit_;}
+		//! Number of misses.
+		size_t get_num_miss() const { return num_miss_;}
+		//! Ratio of hits in lookups.
+		double get_hit_rate() const {
+			auto n = num_hit_ + num_miss_;
+			return 0 < n ? double(num_hit_)/double(n): 0.0;
+		}
+		//! Estimated memory of entries in bytes.
+		size_t get_memory_size() const {
+			return dict_.size()*(sizeof(Key)+sizeof(Entry)+2*sizeof(void*)) + dict_.bucket_count()*sizeof(void*);
+		}
+		//! Reset counters of hits and misses.
+		void reset_stats() { num_hit_ = num_miss_ = 0;}
+		//! Clear entries and counters.
+		void clear() {
+			dict_.clear();
+			this->reset_stats();
+		}
+
+	private:
+		T tol_{T(1.e-6)};//!< Tolerance of geometry.
+		size_t num_hit_{0};//!< Number of hits.
+		size_t num_miss_{0};//!< Number of misses.
+		std::unordered_map<Key, Entry, KeyHash> dict_;//!< Entries of cache.
+};
+
+// //!< Specialization.
+template class ElementCache<REAL4>;
+template class ElementCache<REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_ELEMENT_CACHE_HPP_
@@ -16,95 +16,50 @@ namespace cafea {
 template <class T>
 template <class U>
 void Element<T>::form_matrix(const Node<U, T> p[], const Material<U> *matl,
-							 const Section<U> *sect, const std::vector<LoadCell<U>> load) {
+							 const Section<U> *sect, const std::vector<LoadCell<U>> &load) {
+	const NodeBase<U> *pt[registered_element_list_::max_num_node()];
+	this->node_view(p, pt);
+	this->form_matrix<U>(pt, matl, sect, load);
+}
+/**
+ *  \brief Form element matrix and complex rhs from pointers to nodes.
+ */
+template <class T>
+template <class U>
+void Element<T>::form_matrix(const NodeBase<U>* const p[], const Material<U> *matl,
+							 const Section<U> *sect, const std::vector<LoadCell<U>> &load) {
 	this->form_matrix<U>(p, matl, sect);
 
 	assert(!load.empty());
 	int n2 = load.size();
 
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-		case ElementType::PIPE18:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(12, n2);
+	bool found = registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_stress) {
+			this->rhs_cmplx_ = cmatrix_<T>::Zero(traits_::matrix_dim(), n2);
 			this->load_cmplx_ = cmatrix_<T>::Zero(2, n2);
 			for (int i = 0; i < n2; i++) {
 				this->rhs_cmplx_.col(i).real() = this->rhs_*std::real(load[i].val_cmplx_);
 				this->rhs_cmplx_.col(i).imag() = this->rhs_*std::imag(load[i].val_cmplx_);
 				this->load_cmplx_(0, i) = load[i].val_cmplx_;
 			}
-			break;
-		case ElementType::MASS21:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(6, n2);
-			break;
-		case ElementType::COMBIN14:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(12, n2);
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
-	}
+		} else if constexpr (traits_::has_kernel) {
+			this->rhs_cmplx_ = cmatrix_<T>::Zero(traits_::matrix_dim(), n2);
+		} else {
+			fmt::print("Unsupported element type\n");
+		}
+	});
+	if (!found) fmt::print("Unsupported element type\n");
 }
 /**
  *  \brief Form element matrix.
  */
 template <class T>
 template <class U>
-void Element<T>::form_matrix(const std::vector<Node<U, T>> pt, const Material<U> *mp,
-							 const Section<U> *sect, const std::vector<LoadCell<U>> load) {
-	this->form_matrix<U>(pt, mp, sect);
-
-	assert(!load.empty());
-	int n2 = load.size();
-
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-		case ElementType::PIPE18:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(12, n2);
-			this->load_cmplx_ = cmatrix_<T>::Zero(2, n2);
-			for (int i = 0; i < n2; i++) {
-				this->rhs_cmplx_.col(i).real() = this->rhs_*std::real(load[i].val_cmplx_);
-				this->rhs_cmplx_.col(i).imag() = this->rhs_*std::imag(load[i].val_cmplx_);
-				this->load_cmplx_(0, i) = load[i].val_cmplx_;
-			}
-			break;
-		case ElementType::MASS21:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(6, n2);
-			break;
-		case ElementType::COMBIN14:
-			this->rhs_cmplx_ = cmatrix_<T>::Zero(12, n2);
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
-	}
+void Element<T>::form_matrix(const std::vector<Node<U, T>> &pt, const Material<U> *mp,
+							 const Section<U> *sect, const std::vector<LoadCell<U>> &load) {
+	assert(this->get_total_num_of_node() <= pt.size());
+	this->form_matrix<U>(pt.data(), mp, sect, load);
 }
 
 /**
@@ -116,33 +71,16 @@ void Element<T>::post_stress(const matrix_<U> x) {
 	if (std::type_index(typeid(T)) == std::type_index(typeid(U))) {
 		return this->post_stress(x);
 	}
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-		case ElementType::PIPE18:
-			this->result_cmplx_ = StructuralElementPost<T>::pipe_cmplx(this->stif_, this->tran_,
-				x, this->rhs_cmplx_, this->load_cmplx_, this->attr_);
-			break;
-		case ElementType::MASS21:
-		case ElementType::COMBIN14:
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
-	}
+	bool found = registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_stress) {
+			this->result_cmplx_ = traits_::template stress_cmplx<T>(this->stif_, this->tran_,
+				x, this->rhs_cmplx_, this->load_cmplx_, this->attr_, this->result_req_);
+		} else if constexpr (!traits_::has_kernel) {
+			fmt::print("Unsupported element type\n");
+		}
+	});
+	if (!found) fmt::print("Unsupported element type\n");
 }
 
 /**
@@ -19,85 +19,125 @@ namespace cafea {
 template <class ResT>
 template <class U>
 void Element<ResT>::form_matrix(const Node<U, ResT> p[], const Material<U> *matl, const Section<U> *sect) {
-	auto opt = this->get_option();
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::pipe16(&p[0], &p[1], matl, sect, opt.data());
-			break;
-		case ElementType::PIPE18:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::pipe18(&p[0], &p[1], &p[2], matl, sect);
-			break;
-		case ElementType::MASS21:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::mass21(&p[0], matl, sect, opt.data());
-			break;
-		case ElementType::COMBIN14:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::combin14(&p[0], &p[1], matl, sect, opt.data());
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
-	}
+	const NodeBase<U> *pt[registered_element_list_::max_num_node()];
+	this->node_view(p, pt);
+	this->form_matrix<U>(pt, matl, sect);
+}
+/**
+ *  \brief Form element matrix from pointers to nodes.
+ *  \param [in] p pointers to nodes, only coordinates and angles are read.
+ *  \param [in] matl material struct.
+ *  \param [in] sect section struct.
+ *
+ *  Nodes are not copied, so nodes stored by solution are passed as they are.
+ *  In single precision, kernel is evaluated in REAL4 with twice the lanes of
+ *  REAL8 in fixed-size products, and matrices are widened to ResT before
+ *  transform and assembly.
+ */
+template <class ResT>
+template <class U>
+void Element<ResT>::form_matrix(const NodeBase<U>* const p[], const Material<U> *matl, const Section<U> *sect) {
+	const auto &opt = this->keyopt_;
+	bool found{false};
+	registered_element_list_::visit(this->etype_, [&] (auto tag) {
+		using traits_ = ElementTraits<decltype(tag)::value>;
+		if constexpr (traits_::has_kernel) {
+			for (size_t i = 0; i < traits_::num_node; i++) assert(nullptr != p[i]);
+			if (!this->single_ || std::is_same<ResT, REAL4>::value) {
+				elem_kernel_<ResT, decltype(tag)::value> ke;
+				ke.req = this->eval_req_;
+				traits_::template form<U>(p, matl, sect, opt.data(), ke, this->attr_);
+				this->set_kernel(ke);
+			} else {
+				elem_kernel_<REAL4, decltype(tag)::value> ke;
+				ElementProperty<REAL4> attr;
+				ke.req = this->eval_req_;
+				traits_::template form<U>(p, matl, sect, opt.data(), ke, attr);
+				this->set_kernel(ke);
+				this->attr_ = attr.template cast<ResT>();
+			}
+			found = true;
+		}
+	});
+	if (!found) fmt::print("Unsupported element type\n");
 }
 /**
  *  \brief Form element matrix.
  */
 template <class ResT>
 template <class U>
-void Element<ResT>::form_matrix(const std::vector<Node<U, ResT>> pt, const Material<U> *mp, const Section<U> *sect) {
-	auto opt = this->get_option();
-	switch (this->etype_) {
-		case ElementType::PIPE16:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::pipe16(pt, mp, sect, opt.data());
-			break;
-		case ElementType::PIPE18:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::pipe18(pt, mp, sect);
-			break;
-		case ElementType::MASS21:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::mass21(pt, mp, sect, opt.data());
-			break;
-		case ElementType::COMBIN14:
-			std::tie(this->stif_, this->mass_, this->tran_, this->rhs_,
-				this->attr_) = StructuralElement<U, ResT>::combin14(pt, mp, sect, opt.data());
-			break;
-		case ElementType::BEAM188:
-		case ElementType::B31:
-		case ElementType::C3D4:
-		case ElementType::SOLID185:
-		case ElementType::C3D8:
-		case ElementType::S3R:
-		case ElementType::S4R:
-		case ElementType::SHELL181:
-		case ElementType::BEAM189:
-		case ElementType::B32:
-		case ElementType::SHELL281:
-		case ElementType::S8R:
-		case ElementType::S9R:
-		case ElementType::SOLID186:
-		case ElementType::C3D20:
-		case ElementType::UNKNOWN:
-		default: fmt::print("Unsupported element type\n");
+void Element<ResT>::form_matrix(const std::vector<Node<U, ResT>> &pt, const Material<U> *mp, const Section<U> *sect) {
+	if (ElementAttr::has_kernel(this->etype_)) {
+		assert(this->get_total_num_of_node() <= pt.size());
+		this->form_matrix<U>(pt.data(), mp, sect);
+	} else {
+		fmt::print("Unsupported element type\n");
+	}
+}
+/**
+ *  \brief Load element matrix from batched evaluation.
+ *  \param [in] batch evaluated pipe elements.
+ *  \param [in] i index of this element in batch.
+ */
+template <class ResT>
+template <class U>
+void Element<ResT>::form_matrix(const PipeBatch<U, ResT> &batch, size_t i) {
+	assert(ElementType::PIPE16 == this->etype_);
+	elem_kernel_<ResT, ElementType::PIPE16> ke;
+	ke.req = this->eval_req_;
+	batch.get_kernel(i, ke, this->attr_);
+	this->set_kernel(ke);
+}
+/**
+ *  \brief Form element matrix with cache of local matrices.
+ */
+template <class ResT>
+template <class U>
+void Element<ResT>::form_matrix(const Node<U, ResT> p[], const Material<U> *matl, const Section<U> *sect,
+	ElementCache<ResT> &cache) {
+	const NodeBase<U> *pt[registered_element_list_::max_num_node()];
+	this->node_view(p, pt);
+	this->form_matrix<U>(pt, matl, sect, cache);
+}
+/**
+ *  \brief Form element matrix with cache of local matrices.
+ *  \param [in] p pointers to nodes.
+ *  \param [in] matl material struct.
+ *  \param [in] sect section struct.
+ *  \param [in,out] cache local matrices of formed elements.
+ *
+ *  Only transform matrix is evaluated when local matrices are found in cache,
+ *  and elements not supported by cache are formed directly. Entries are
+ *  always formed in full, so the cache is shared by all requests. Precision
+ *  of kernel is not part of key, and entries are shared by both precisions.
+ */
+template <class ResT>
+template <class U>
+void Element<ResT>::form_matrix(const NodeBase<U>* const p[], const Material<U> *matl, const Section<U> *sect,
+	ElementCache<ResT> &cache) {
+	if (!ElementCache<ResT>::is_cached(this->etype_)) {
+		this->form_matrix<U>(p, matl, sect);
+		return;
+	}
+	mat3_<ResT> tt;
+	ResT geom = ElementType::PIPE18 == this->etype_ ? NodeFunc<U, ResT>::coord_tran(p[0], p[1], p[2], tt):
+		NodeFunc<U, ResT>::coord_tran(p[0], p[1], tt);
+	auto key = cache.make_key(this->etype_, this->matl_, this->sect_, this->keyopt_, geom);
+	auto val = cache.find(key);
+	if (nullptr != val) {
+		this->set_kernel(*val, tt);
+		return;
 	}
+	auto req = this->eval_req_;
+	this->eval_req_ = EvalRequest::ALL;
+	this->form_matrix<U>(p, matl, sect);
+	this->eval_req_ = req;
+	typename ElementCache<ResT>::Entry ent;
+	ent.stif = this->stif_;
+	ent.mass = this->mass_;
+	ent.rhs = this->rhs_;
+	ent.attr = this->attr_;
+	this->set_kernel(*cache.insert(key, ent), tt);
 }
 }
 #endif  // CAFEA_ELEMENT_EXT_HPP
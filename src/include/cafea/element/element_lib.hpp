@@ -7,7 +7,6 @@
 #ifndef CAFEA_ELEMENT_LIB_HPP_
 #define CAFEA_ELEMENT_LIB_HPP_
 
-#include <map>
 #include <tuple>
 #include <string>
 #include <vector>
@@ -17,11 +16,33 @@
 #include "cafea/base/load.hpp"
 #include "cafea/base/section.hpp"
 #include "cafea/base/material.hpp"
+#include "cafea/base/load_combination.hpp"
+#include "cafea/element/element_attr.hpp"
+#include "cafea/element/result_request.hpp"
 
 namespace cafea {
 //! Define out variables.
 template <class T>
-using elem_out_5 = std::tuple<matrix_<T>, matrix_<T>, matrix_<T>, vecX_<T>, std::map<std::string, T>>;
+using elem_out_5 = std::tuple<matrix_<T>, matrix_<T>, matrix_<T>, vecX_<T>, ElementProperty<T>>;
+/**
+ *  \brief Element matrix in fixed size without heap allocation.
+ *
+ *  Kernels may skip mass, rhs and attribute not in request, and those
+ *  members are left unspecified.
+ */
+template <class U, int N>
+struct ElementKernel {
+	matN_<U, N> stif;//!< Stiffness matrix.
+	matN_<U, N> mass;//!< Mass matrix.
+	matN_<U, N> tran;//!< Transform matrix.
+	vecN_<U, N> rhs;//!< Right-hand side vector.
+	EvalRequest req{EvalRequest::ALL};//!< Data requested by solution.
+	//! Request r is wanted or not.
+	bool want(EvalRequest r) const { return has_request(req, r);}
+};
+//! Element kernel sized by element type.
+template <class U, ElementType ET>
+using elem_kernel_ = ElementKernel<U, ElementAttr::get_matrix_dim<ET>()>;
 /**
  * \brief Interface for structural elements.
  */
@@ -35,22 +56,30 @@ struct StructuralElement {
 	static elem_out_5<U> pipe16(const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*, const int*);
 
 	static elem_out_5<U> pipe16(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*, const int*);
+	static void pipe16(const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*, const int*,
+					   elem_kernel_<U, ElementType::PIPE16>&, ElementProperty<U>&);
 	/**
 	 *  \brief 2-node elbow pipe element.
 	 */
 	static elem_out_5<U> pipe18(const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*);
 	static elem_out_5<U> pipe18(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*);
+	static void pipe18(const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*,
+					   elem_kernel_<U, ElementType::PIPE18>&, ElementProperty<U>&);
 
 	/**
 	 *  \brief 1-node mass element.
 	 */
 	static elem_out_5<U> mass21(const NodeBase<T>*, const Material<T>*, const Section<T>*, const int[]);
 	static elem_out_5<U> mass21(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*, const int[]);
+	static void mass21(const NodeBase<T>*, const Material<T>*, const Section<T>*, const int[],
+					   elem_kernel_<U, ElementType::MASS21>&, ElementProperty<U>&);
 	/**
 	 *  \brief 2-node spring element.
 	 */
 	static elem_out_5<U> combin14(const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*, const int[]);
 	static elem_out_5<U> combin14(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*, const int[]);
+	static void combin14(const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*, const int[],
+						 elem_kernel_<U, ElementType::COMBIN14>&, ElementProperty<U>&);
 	/**
 	 *  \brief 8-node Mindlin shell element.
 	 */
@@ -58,13 +87,27 @@ struct StructuralElement {
 								 const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*,
 								 const Material<T>*, const Section<T>*);
 	static elem_out_5<U> shell8r(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*);
+	static void shell8r(const NodeBase<T>* const[], const Material<T>*, const Section<T>*, const int*,
+						elem_kernel_<U, ElementType::S8R>&, ElementProperty<U>&);
 	/**
-	 * \ brief 9-node Mindlin shell elment.
+	 *  \brief 9-node Mindlin shell element.
 	 */
 	static elem_out_5<U> shell9r(const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*,
 								 const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*, const NodeBase<T>*,
 								 const NodeBase<T>*, const Material<T>*, const Section<T>*);
 	static elem_out_5<U> shell9r(const std::vector<Node<T, U>>, const Material<T>*, const Section<T>*);
+	static void shell9r(const NodeBase<T>* const[], const Material<T>*, const Section<T>*, const int*,
+						elem_kernel_<U, ElementType::S9R>&, ElementProperty<U>&);
+	/**
+	 *  \brief 8-node hexahedral solid element.
+	 */
+	static void solid185(const NodeBase<T>* const[], const Material<T>*, const Section<T>*, const int*,
+						 elem_kernel_<U, ElementType::SOLID185>&, ElementProperty<U>&);
+	/**
+	 *  \brief 20-node hexahedral solid element.
+	 */
+	static void solid186(const NodeBase<T>* const[], const Material<T>*, const Section<T>*, const int*,
+						 elem_kernel_<U, ElementType::SOLID186>&, ElementProperty<U>&);
 };
 /**
  *  \brief Interface for structural element post process.
@@ -76,14 +119,41 @@ struct StructuralElementPost {
 	 *  \brief 2-node straight/elbow pipe element post process.
 	 */
 	static matrix_<T> pipe(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
-						   const matrix_<T> rhs, const std::map<std::string, T> attr,
-						   bool is_pres = false, T pres_in = T(0), T pres_out = T(0));
+						   const matrix_<T> rhs, const ElementProperty<T> &attr,
+						   bool is_pres = false, T pres_in = T(0), T pres_out = T(0),
+						   const ResultRequest &req = ResultRequest());
 	/**
 	 *  \brief 2-node straight/elbow pipe element post process in complex domain.
 	 */
 	static cmatrix_<T> pipe_cmplx(const matrix_<T> stif, const matrix_<T> tran,
 								  const cmatrix_<T> x, const cmatrix_<T> rhs,
-								  const cmatrix_<T> load, const std::map<std::string, T> attr);
+								  const cmatrix_<T> load, const ElementProperty<T> &attr,
+								  const ResultRequest &req = ResultRequest());
+	/**
+	 *  \brief 2-node straight/elbow pipe member force of multiple displacements.
+	 */
+	static matrix_<T> pipe_force(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
+								 const ElementProperty<T> &attr);
+	/**
+	 *  \brief Rotate member force of elbow pipe.
+	 */
+	static matrix_<T> pipe_elbow(const matrix_<T> force, const ElementProperty<T> &attr);
+	/**
+	 *  \brief 2-node straight/elbow pipe stress from member force.
+	 */
+	static void pipe_stress(matrix_<T> &esol, const ElementProperty<T> &attr,
+							bool is_pres = false, T pres_in = T(0), T pres_out = T(0));
+	/**
+	 *  \brief 2-node straight/elbow pipe stress of multiple member forces.
+	 */
+	static matrix_<T> pipe_stress_batch(const matrix_<T> &force, const ElementProperty<T> &attr,
+										const vecX_<T> &pres, const ResultRequest &req = ResultRequest());
+	/**
+	 *  \brief 2-node straight/elbow pipe result of load combinations.
+	 */
+	static matrix_<T> pipe_combine(const matrix_<T> stif, const matrix_<T> tran, const matrix_<T> x,
+								   const matrix_<T> rhs, const vecX_<T> &pres, const ElementProperty<T> &attr,
+								   const LoadCombination<T> &comb, const ResultRequest &req = ResultRequest());
 };
 // //!< Specialization.
 template struct StructuralElement<REAL4, REAL4>;
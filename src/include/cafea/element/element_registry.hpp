@@ -0,0 +1,202 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_ELEMENT_REGISTRY_HPP_
+#define CAFEA_ELEMENT_REGISTRY_HPP_
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+template <class T> class NodeBase;
+template <class T> class ElementProperty;
+template <class T, class U> struct StructuralElement;
+template <class T> struct StructuralElementPost;
+/**
+ *  \brief Constant attributes of element type.
+ *  \tparam NN total number of nodes.
+ *  \tparam NA number of active nodes in element matrix.
+ *  \tparam ND dofs per node.
+ *  \tparam OD order of shape function.
+ *  \tparam ID id of element type in Ansys rules.
+ *  \tparam AN element is named after Ansys.
+ */
+template <size_t NN, size_t NA, size_t ND, size_t OD, size_t ID, bool AN = false>
+struct ElementTraitsBase {
+	static constexpr size_t num_node{NN};//!< Total number of nodes.
+	static constexpr size_t num_active_node{NA};//!< Number of active nodes.
+	static constexpr size_t dofs_per_node{ND};//!< Dofs per node.
+	static constexpr size_t order{OD};//!< Order of shape function.
+	static constexpr size_t type_id{ID};//!< Id of element type in Ansys rules.
+	static constexpr bool is_ansys{AN};//!< Element is named after Ansys.
+	static constexpr bool has_kernel{false};//!< Element matrix is available.
+	static constexpr bool has_stress{false};//!< Stress post process is available.
+	//! Dimension of element matrix.
+	static constexpr int matrix_dim() { return static_cast<int>(NA*ND);}
+};
+/**
+ *  \brief Traits of element type, unknown type by default.
+ *
+ *  A new element type is registered by one specialization and one entry of
+ *  registered_element_list_. Kernel is formed by static function form from
+ *  pointers to nodes, and pipe post processes are shared by PipeTraits.
+ */
+template <ElementType ET>
+struct ElementTraits: ElementTraitsBase<0, 0, 0, 0, 0> {};
+/**
+ *  \brief Post process of straight and elbow pipe.
+ */
+template <size_t NN, size_t ID>
+struct PipeTraits: ElementTraitsBase<NN, 2, 6, 1, ID, true> {
+	static constexpr bool has_kernel{true};
+	static constexpr bool has_stress{true};
+	//! Stress of element.
+	template <class T, class... Args>
+	static auto stress(Args&&... args) { return StructuralElementPost<T>::pipe(std::forward<Args>(args)...);}
+	//! Stress of element in complex domain.
+	template <class T, class... Args>
+	static auto stress_cmplx(Args&&... args) { return StructuralElementPost<T>::pipe_cmplx(std::forward<Args>(args)...);}
+	//! Member force of multiple displacements.
+	template <class T, class... Args>
+	static auto member_force(Args&&... args) { return StructuralElementPost<T>::pipe_force(std::forward<Args>(args)...);}
+	//! Stress from member force.
+	template <class T, class... Args>
+	static void force_stress(Args&&... args) { StructuralElementPost<T>::pipe_stress(std::forward<Args>(args)...);}
+};
+
+//! 2-node straight pipe.
+template <>
+struct ElementTraits<ElementType::PIPE16>: PipeTraits<2, 16> {
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int *opt, K &ke, ElementProperty<U> &attr) {
+		StructuralElement<T, U>::pipe16(p[0], p[1], matl, sect, opt, ke, attr);
+	}
+};
+//! 2-node elbow pipe with center node.
+template <>
+struct ElementTraits<ElementType::PIPE18>: PipeTraits<3, 18> {
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int*, K &ke, ElementProperty<U> &attr) {
+		StructuralElement<T, U>::pipe18(p[0], p[1], p[2], matl, sect, ke, attr);
+	}
+};
+//! 1-node mass.
+template <>
+struct ElementTraits<ElementType::MASS21>: ElementTraitsBase<1, 1, 6, 0, 21, true> {
+	static constexpr bool has_kernel{true};
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int *opt, K &ke, ElementProperty<U> &attr) {
+		StructuralElement<T, U>::mass21(p[0], matl, sect, opt, ke, attr);
+	}
+};
+//! 2-node spring.
+template <>
+struct ElementTraits<ElementType::COMBIN14>: ElementTraitsBase<2, 2, 6, 0, 14, true> {
+	static constexpr bool has_kernel{true};
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int *opt, K &ke, ElementProperty<U> &attr) {
+		StructuralElement<T, U>::combin14(p[0], p[1], matl, sect, opt, ke, attr);
+	}
+};
+/**
+ *  \brief Mindlin shell with quadratic shape.
+ */
+template <size_t NN, size_t ID, bool AN = false>
+struct ShellTraits: ElementTraitsBase<NN, NN, 6, 2, ID, AN> {
+	static constexpr bool has_kernel{true};
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int *opt, K &ke, ElementProperty<U> &attr) {
+		if constexpr (9 == NN) {
+			StructuralElement<T, U>::shell9r(p, matl, sect, opt, ke, attr);
+		} else {
+			StructuralElement<T, U>::shell8r(p, matl, sect, opt, ke, attr);
+		}
+	}
+};
+//! 8-node shell.
+template <> struct ElementTraits<ElementType::SHELL281>: ShellTraits<8, 281, true> {};
+template <> struct ElementTraits<ElementType::S8R>: ShellTraits<8, 281> {};
+//! 9-node shell.
+template <> struct ElementTraits<ElementType::S9R>: ShellTraits<9, 0> {};
+/**
+ *  \brief Hexahedral solid.
+ *  \tparam FI full integration of 20-node element.
+ */
+template <size_t NN, size_t ID, bool AN = false, bool FI = false>
+struct SolidTraits: ElementTraitsBase<NN, NN, 3, 8 == NN ? 1: 2, ID, AN> {
+	static constexpr bool has_kernel{true};
+	template <class T, class P, class M, class S, class K, class U>
+	static void form(const P *const p[], const M *matl, const S *sect, const int *opt, K &ke, ElementProperty<U> &attr) {
+		if constexpr (8 == NN) {
+			StructuralElement<T, U>::solid185(p, matl, sect, opt, ke, attr);
+		} else if constexpr (FI) {
+			int full[10] = {nullptr != opt ? opt[0]: 0, 1};
+			StructuralElement<T, U>::solid186(p, matl, sect, full, ke, attr);
+		} else {
+			StructuralElement<T, U>::solid186(p, matl, sect, opt, ke, attr);
+		}
+	}
+};
+//! 8-node hexahedron.
+template <> struct ElementTraits<ElementType::SOLID185>: SolidTraits<8, 185, true> {};
+template <> struct ElementTraits<ElementType::C3D8>: SolidTraits<8, 185> {};
+//! 20-node hexahedron, C3D20 is fully integrated.
+template <> struct ElementTraits<ElementType::SOLID186>: SolidTraits<20, 186, true> {};
+template <> struct ElementTraits<ElementType::C3D20>: SolidTraits<20, 20, false, true> {};
+template <> struct ElementTraits<ElementType::BEAM188>: ElementTraitsBase<2, 2, 6, 1, 188, true> {};
+template <> struct ElementTraits<ElementType::BEAM189>: ElementTraitsBase<3, 3, 6, 2, 189, true> {};
+template <> struct ElementTraits<ElementType::B31>: ElementTraitsBase<2, 2, 6, 1, 188> {};
+template <> struct ElementTraits<ElementType::B32>: ElementTraitsBase<3, 3, 6, 2, 189> {};
+template <> struct ElementTraits<ElementType::C3D4>: ElementTraitsBase<4, 4, 3, 1, 0> {};
+template <> struct ElementTraits<ElementType::SHELL181>: ElementTraitsBase<4, 4, 6, 1, 181, true> {};
+template <> struct ElementTraits<ElementType::S3R>: ElementTraitsBase<3, 3, 6, 1, 0> {};
+template <> struct ElementTraits<ElementType::S4R>: ElementTraitsBase<4, 4, 6, 1, 181> {};
+
+//! Tag of element type at compile time.
+template <ElementType ET>
+using element_tag_ = std::integral_constant<ElementType, ET>;
+/**
+ *  \brief List of element types.
+ */
+template <ElementType... ET>
+struct ElementTypeList {
+	//! Number of element types.
+	static constexpr size_t size() { return sizeof...(ET);}
+	/**
+	 *  \brief Call function with tag of element type.
+	 *  \param [in] et type of element.
+	 *  \param [in] fn function called as fn(element_tag_<ET>{}).
+	 *  \return false when et is not in list.
+	 *
+	 *  The only runtime branch is selection of type, and fn is instantiated
+	 *  for each type in list.
+	 */
+	template <class F>
+	static constexpr bool visit(ElementType et, F &&fn) {
+		return ((et == ET ? (fn(element_tag_<ET>{}), true): false) || ...);
+	}
+	//! Call function with tag of each type in list.
+	template <class F>
+	static constexpr void for_each(F &&fn) { (fn(element_tag_<ET>{}), ...);}
+	//! Maximum number of nodes of types in list.
+	static constexpr size_t max_num_node() {
+		size_t res{0};
+		((res = res < ElementTraits<ET>::num_node ? ElementTraits<ET>::num_node: res), ...);
+		return res;
+	}
+};
+//! Registered element types, Ansys named types come first.
+using registered_element_list_ = ElementTypeList<
+	ElementType::PIPE16, ElementType::PIPE18, ElementType::MASS21, ElementType::COMBIN14,
+	ElementType::BEAM188, ElementType::BEAM189, ElementType::SOLID185, ElementType::SOLID186,
+	ElementType::SHELL181, ElementType::SHELL281, ElementType::B31, ElementType::B32,
+	ElementType::C3D4, ElementType::C3D8, ElementType::C3D20, ElementType::S3R,
+	ElementType::S4R, ElementType::S8R, ElementType::S9R>;
+}  // namespace cafea
+#endif  // CAFEA_ELEMENT_REGISTRY_HPP_
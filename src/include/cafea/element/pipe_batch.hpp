@@ -0,0 +1,67 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_PIPE_BATCH_HPP_
+#define CAFEA_PIPE_BATCH_HPP_
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+#include "cafea/element/element_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Batched evaluation of 2-node straight pipe elements.
+ *
+ *  Node coordinates, material and section data of many PIPE16 elements are
+ *  gathered into structure of arrays, then the distinct entries of element
+ *  matrices are evaluated in SIMD lanes and stored contiguously per element.
+ *  Each kernel is scattered on demand and equals StructuralElement<T, U>::pipe16
+ *  of the same element.
+ */
+template <class T = REAL4, class U = REAL8>
+class PipeBatch {
+	static_assert(std::is_floating_point<T>::value, "PipeBatch<T, U>: T must be floating type.");
+	static_assert(std::is_floating_point<U>::value, "PipeBatch<T, U>: U must be floating type.");
+	public:
+		//! Reserve number of elements.
+		void reserve(size_t n);
+		//! Append an element.
+		void add(const NodeBase<T>*, const NodeBase<T>*, const Material<T>*, const Section<T>*, const int*);
+		//! Evaluate all elements.
+		void evaluate();
+		//! Scatter kernel of element.
+		void get_kernel(size_t i, elem_kernel_<U, ElementType::PIPE16> &ke, ElementProperty<U> &attr) const;
+		//! Number of elements.
+		size_t size() const { return lumped_.size();}
+		//! Clear variables.
+		void clear() {
+			for (auto &it: in_) it.clear();
+			out_.clear();
+			lumped_.clear();
+		}
+
+	private:
+		//! Input fields.
+		enum { DX, DY, DZ, YOUNG, PRXY, DENS, RO, RI, DENSFL, PRESIN, NUM_IN};
+		//! Output fields.
+		enum { LEN, T00, T01, T02, T10, T11, T12, T20, T21, T22,
+			AX, JX, IY, ME, KA, KT, KB1, KB2, KB3, KB4,
+			MA, MT, M11, M55, M115, M51, M75, M71, MF, RHS, NUM_OUT};
+		std::array<std::vector<U>, NUM_IN> in_;//!< Input data of elements.
+		std::vector<U> out_;//!< Distinct entries of element matrices, stored per element.
+		std::vector<int> lumped_;//!< Lumped mass option.
+};
+
+// //!< Specialization.
+template class PipeBatch<REAL4, REAL4>;
+template class PipeBatch<REAL4, REAL8>;
+template class PipeBatch<REAL8, REAL4>;
+template class PipeBatch<REAL8, REAL8>;
+}  // namespace cafea
+#endif  // CAFEA_PIPE_BATCH_HPP_
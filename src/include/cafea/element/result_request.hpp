@@ -0,0 +1,72 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_RESULT_REQUEST_HPP_
+#define CAFEA_RESULT_REQUEST_HPP_
+
+#include <array>
+#include <cstddef>
+
+#include "cafea/base/enum_lib.hpp"
+
+namespace cafea {
+/**
+ *  \brief Layout of pipe result rows requested by solution.
+ *
+ *  Default request is the full layout of 99 rows: member force in rows 0-5,
+ *  SDIR, SBEND, ST, SH and SSF in rows 6-10, then SAXL, SXH, S1, S2 and
+ *  SEQV at 8 circumferential points from row 11. Other requests keep only
+ *  the listed quantities at the selected points, in the same order, followed
+ *  by envelopes over the points, maximum for S2 is the minimum. Quantities
+ *  not stored are computed only when others depend on them.
+ */
+class ResultRequest {
+	public:
+		//! Number of circumferential points.
+		static constexpr int num_point{8};
+		//! Full layout of 99 rows.
+		ResultRequest() { init(PipeResult::ALL, 0xFFu, PipeResult::NONE, true);}
+		/**
+		 *  \brief Request of quantities.
+		 *  \param[in] quantity stored quantities.
+		 *  \param[in] points bit mask of circumferential points, bit j for angle 45*j degree.
+		 *  \param[in] envelope quantities at points of which envelopes are stored.
+		 */
+		explicit ResultRequest(PipeResult quantity, unsigned points = 0xFFu, PipeResult envelope = PipeResult::NONE) {
+			init(quantity, points, envelope, false);
+		}
+		//! Request is full layout or not.
+		bool is_full() const { return full_;}
+		//! Get number of rows.
+		int get_num_row() const { return num_row_;}
+		//! Get stored quantities.
+		PipeResult get_quantity() const { return quantity_;}
+		//! Get quantities of envelopes.
+		PipeResult get_envelope() const { return envelope_;}
+		//! Circumferential point j is selected or not.
+		bool has_point(int j) const { return 0 != (points_ & (1u << j));}
+		//! Quantity is needed by stored rows or not.
+		bool need(PipeResult q) const { return has_request(need_, q);}
+		//! Get row of quantity, at circumferential point j for point quantities, -1 when not stored.
+		int get_row(PipeResult q, int j = 0) const;
+		//! Get row of envelope of quantity, -1 when not stored.
+		int get_envelope_row(PipeResult q) const;
+
+	private:
+		PipeResult quantity_;//!< Stored quantities.
+		PipeResult envelope_;//!< Quantities of envelopes.
+		PipeResult need_;//!< Stored quantities and their dependencies.
+		unsigned points_;//!< Bit mask of circumferential points.
+		bool full_;//!< Full layout.
+		int num_row_;//!< Number of rows.
+		std::array<int, 11> row_;//!< First row of quantities, -1 when not stored.
+		std::array<int, 11> env_;//!< Row of envelopes, -1 when not stored.
+
+		//! Build layout.
+		void init(PipeResult quantity, unsigned points, PipeResult envelope, bool full);
+};
+}  // namespace cafea
+#endif  // CAFEA_RESULT_REQUEST_HPP_
@@ -0,0 +1,79 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#ifndef CAFEA_ALLOC_COUNTER_HPP_
+#define CAFEA_ALLOC_COUNTER_HPP_
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+namespace cafea {
+/**
+ *  \class Counter of heap allocations.
+ *
+ *  Allocations are only counted in program whose one translation unit
+ *  defines CAFEA_ALLOC_COUNTER_IMPL before including this header, such as
+ *  main of test or benchmark. With glibc malloc, calloc and realloc are
+ *  counted, which covers operator new and storage of Eigen matrices.
+ *  Otherwise only operator new is counted.
+ */
+class AllocCounter {
+	public:
+		//! A constructor.
+		AllocCounter(): beg_(total()) {}
+		//! Reset counter.
+		void reset() { beg_ = total();}
+		//! Get number of allocations since construction or reset.
+		size_t count() const { return total()-beg_;}
+		//! Get number of allocations since start of program.
+		static size_t total() { return num_.load(std::memory_order_relaxed);}
+		//! Count one allocation.
+		static void add() { num_.fetch_add(1, std::memory_order_relaxed);}
+
+	private:
+		inline static std::atomic<size_t> num_{0};//!< Number of allocations.
+		size_t beg_;//!< Number of allocations at beginning.
+};
+}  // namespace cafea
+
+#ifdef CAFEA_ALLOC_COUNTER_IMPL
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+//! Counted malloc.
+void* malloc(size_t n) {
+	cafea::AllocCounter::add();
+	return __libc_malloc(n);
+}
+//! Counted calloc.
+void* calloc(size_t n, size_t m) {
+	cafea::AllocCounter::add();
+	return __libc_calloc(n, m);
+}
+//! Counted realloc.
+void* realloc(void *p, size_t n) {
+	cafea::AllocCounter::add();
+	return __libc_realloc(p, n);
+}
+}
+#else
+//! Counted operator new.
+void* operator new(std::size_t n) {
+	cafea::AllocCounter::add();
+	if (void *p = std::malloc(0 < n ? n: 1)) return p;
+	throw std::bad_alloc();
+}
+//! Operator delete of counted operator new.
+void operator delete(void *p) noexcept { std::free(p);}
+//! Sized operator delete of counted operator new.
+void operator delete(void *p, std::size_t) noexcept { std::free(p);}
+#endif
+#endif  // CAFEA_ALLOC_COUNTER_IMPL
+#endif  // CAFEA_ALLOC_COUNTER_HPP_
@@ -1,10 +1,99 @@
 #ifndef CAFEA_GAUSS_LEGENDRE_HPP_
 #define CAFEA_GAUSS_LEGENDRE_HPP_
 
+#include <array>
+#include <cstddef>
+
 #include "cafea/utils/utils.hpp"
 
 namespace cafea {
 inline namespace utility {
+	/**
+	 *  \brief Gauss-Legendre rule in fixed size.
+	 *  \tparam N number of points.
+	 *  \tparam D dimension of tensor product rule.
+	 *  \tparam T numerical type.
+	 */
+	template <size_t N, size_t D = 1, class T = REAL8>
+	struct GaussRule {
+		//! Number of points in each direction.
+		static constexpr size_t num_dir_point() { return N;}
+		//! Number of points.
+		static constexpr size_t size() {
+			size_t n{1};
+			for (size_t i = 0; i < D; i++) n *= N;
+			return n;
+		}
+		std::array<std::array<T, D>, size()> pt{};//!< Points, first coordinate runs fastest.
+		std::array<T, size()> wt{};//!< Weights.
+	};
+	namespace detail {
+		//! Cosine by Taylor series for initial guess of roots.
+		constexpr long double cos_series(long double x) {
+			long double res{1.0L}, term{1.0L};
+			for (int k = 1; k < 40; k++) {
+				term *= -x*x/((2*k-1)*(2*k));
+				res += term;
+			}
+			return res;
+		}
+		/**
+		 *  \brief Roots of Legendre polynomial by Newton iteration.
+		 *
+		 *  Points are in ascending order, same as eigenvalues of Golub-Welsch
+		 *  method in former runtime version.
+		 */
+		template <size_t N, class T>
+		constexpr GaussRule<N, 1, T> gauss_rule_1d() {
+			static_assert(0 < N, "Number of Gauss points must be positive.");
+			constexpr long double pi{3.141592653589793238462643383279502884L};
+			GaussRule<N, 1, T> res;
+			for (size_t i = 0; i < (N+1)/2; i++) {
+				long double z = cos_series(pi*(i+0.75L)/(N+0.5L)), pp{0.0L};
+				for (int it = 0; it < 100; it++) {
+					long double p1{1.0L}, p2{0.0L};
+					for (size_t j = 1; j <= N; j++) {
+						long double p3 = p2;
+						p2 = p1;
+						p1 = ((2.0L*j-1.0L)*z*p2-(j-1.0L)*p3)/j;
+					}
+					pp = N*(z*p1-p2)/(z*z-1.0L);
+					long double dz = p1/pp;
+					z -= dz;
+					if ((dz < 0.0L ? -dz: dz) < 1.e-19L) break;
+				}
+				if (1 == N%2 && (N-1)/2 == i) z = 0.0L;
+				long double w = 2.0L/((1.0L-z*z)*pp*pp);
+				res.pt[i][0] = static_cast<T>(-z);
+				res.pt[N-1-i][0] = static_cast<T>(z);
+				res.wt[i] = res.wt[N-1-i] = static_cast<T>(w);
+			}
+			return res;
+		}
+		//! Tensor product of one dimensional rule.
+		template <size_t N, size_t D, class T>
+		constexpr GaussRule<N, D, T> gauss_rule() {
+			constexpr auto r1 = gauss_rule_1d<N, long double>();
+			GaussRule<N, D, T> res;
+			for (size_t k = 0; k < res.size(); k++) {
+				long double w{1.0L};
+				for (size_t d = 0, m = k; d < D; d++, m /= N) {
+					res.pt[k][d] = static_cast<T>(r1.pt[m%N][0]);
+					w *= r1.wt[m%N];
+				}
+				res.wt[k] = static_cast<T>(w);
+			}
+			return res;
+		}
+	}
+	/**
+	 *  \brief Gauss-Legendre points and weights evaluated at compile time.
+	 *  \tparam N number of points in each direction.
+	 *  \tparam D dimension, 1 for line, 2 for quadrangle and 3 for hexahedron.
+	 *  \tparam T numerical type.
+	 */
+	template <size_t N, size_t D = 1, class T = REAL8>
+	inline constexpr GaussRule<N, D, T> gauss_rule_v = detail::gauss_rule<N, D, T>();
 	/**
 	 * \brief Gauss-Legendre integrate point and weight.
  	 * \tparam nPoints number of points
@@ -12,21 +101,12 @@ inline namespace utility {
 	 * \return integrate point and weight value
  	*/
 	template <size_t nPoints = 2, class T = REAL8>
-	constexpr std::pair<vecX_<T>, vecX_<T>> gauss_quad() {
-		assert(0 < nPoints);
-		vecX_<T> pt = vecX_<T>::Zero(nPoints), wt = pt;
-		if constexpr (1 == nPoints) {
-			pt << T(0.0);
-			wt << T(2.0);
-		} else {
-			matrix_<T> ma = matrix_<T>::Zero(nPoints, nPoints);
-			vecX_<T> subDiag = vecX_<T>::LinSpaced(nPoints-1, 1, nPoints-1);
-			// Only low triangular part of matrix is required.
-			ma.diagonal(-1) = subDiag.unaryExpr([](T x) { return x/std::sqrt(T(4.0)*x*x-T(1.0));});
-			Eigen::SelfAdjointEigenSolver<matrix_<T>> eigenSolver(ma);
-			assert(Eigen::ComputationInfo::Success == eigenSolver.info());
-			pt = eigenSolver.eigenvalues();
-			wt = T(2.0)*eigenSolver.eigenvectors().row(0).cwiseAbs2();
+	std::pair<vecX_<T>, vecX_<T>> gauss_quad() {
+		const auto &r = gauss_rule_v<nPoints, 1, T>;
+		vecX_<T> pt(nPoints), wt(nPoints);
+		for (size_t i = 0; i < nPoints; i++) {
+			pt(i) = r.pt[i][0];
+			wt(i) = r.wt[i];
 		}
 		return std::make_pair(pt, wt);
 	}
@@ -0,0 +1,170 @@
+#ifndef CAFEA_SHAPE_FUNCTION_HPP_
+#define CAFEA_SHAPE_FUNCTION_HPP_
+
+#include <array>
+#include <cstddef>
+
+#include "cafea/utils/gauss_legendre.hpp"
+
+namespace cafea {
+inline namespace utility {
+	/**
+	 *  \brief Isoparametric shape of continuum element.
+	 */
+	enum class ShapeType {
+		LINE2,//!< 2-node line.
+		LINE3,//!< 3-node line, middle node is the last.
+		QUAD4,//!< 4-node quadrangle.
+		QUAD8,//!< 8-node serendipity quadrangle.
+		QUAD9,//!< 9-node Lagrange quadrangle.
+		HEX8,//!< 8-node hexahedron.
+		HEX20,//!< 20-node serendipity hexahedron.
+	};
+	/**
+	 *  \brief Natural coordinates of nodes in Ansys order.
+	 *  \tparam NN number of nodes.
+	 *  \tparam D dimension.
+	 *  \tparam OD order of one dimensional polynomial.
+	 *  \tparam SE serendipity or tensor product of Lagrange polynomial.
+	 */
+	template <size_t NN, size_t D, size_t OD, bool SE = false>
+	struct ShapeNodesBase {
+		static constexpr size_t num_node{NN};//!< Number of nodes.
+		static constexpr size_t dim{D};//!< Dimension.
+		static constexpr size_t order{OD};//!< Order of polynomial.
+		static constexpr bool serendipity{SE};//!< Serendipity family.
+	};
+	template <ShapeType ST> struct ShapeNodes;
+	template <> struct ShapeNodes<ShapeType::LINE2>: ShapeNodesBase<2, 1, 1> {
+		static constexpr int coord[2][1] = {{-1}, {1}};
+	};
+	template <> struct ShapeNodes<ShapeType::LINE3>: ShapeNodesBase<3, 1, 2> {
+		static constexpr int coord[3][1] = {{-1}, {1}, {0}};
+	};
+	template <> struct ShapeNodes<ShapeType::QUAD4>: ShapeNodesBase<4, 2, 1> {
+		static constexpr int coord[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+	};
+	template <> struct ShapeNodes<ShapeType::QUAD8>: ShapeNodesBase<8, 2, 2, true> {
+		static constexpr int coord[8][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1},
+			{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+	};
+	template <> struct ShapeNodes<ShapeType::QUAD9>: ShapeNodesBase<9, 2, 2> {
+		static constexpr int coord[9][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1},
+			{0, -1}, {1, 0}, {0, 1}, {-1, 0}, {0, 0}};
+	};
+	template <> struct ShapeNodes<ShapeType::HEX8>: ShapeNodesBase<8, 3, 1> {
+		static constexpr int coord[8][3] = {{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+			{-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1}};
+	};
+	template <> struct ShapeNodes<ShapeType::HEX20>: ShapeNodesBase<20, 3, 2, true> {
+		static constexpr int coord[20][3] = {{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+			{-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1},
+			{0, -1, -1}, {1, 0, -1}, {0, 1, -1}, {-1, 0, -1},
+			{0, -1, 1}, {1, 0, 1}, {0, 1, 1}, {-1, 0, 1},
+			{-1, -1, 0}, {1, -1, 0}, {1, 1, 0}, {-1, 1, 0}};
+	};
+	/**
+	 *  \brief Shape functions and derivatives in natural coordinate.
+	 *  \tparam ST shape of element.
+	 *  \tparam T numerical type.
+	 */
+	template <ShapeType ST, class T = REAL8>
+	struct ShapeFunction {
+		using nodes_ = ShapeNodes<ST>;
+		static constexpr size_t num_node{nodes_::num_node};//!< Number of nodes.
+		static constexpr size_t dim{nodes_::dim};//!< Dimension.
+		using point_ = std::array<T, dim>;
+		using value_ = std::array<T, num_node>;
+		using deriv_ = std::array<std::array<T, num_node>, dim>;
+		//! Shape function of each node.
+		static constexpr value_ value(const point_ &x) {
+			value_ res{};
+			for (size_t i = 0; i < num_node; i++) res[i] = eval(i, x, dim);
+			return res;
+		}
+		//! Derivative of shape function, first index is direction.
+		static constexpr deriv_ deriv(const point_ &x) {
+			deriv_ res{};
+			for (size_t j = 0; j < dim; j++) {
+				for (size_t i = 0; i < num_node; i++) res[j][i] = eval(i, x, j);
+			}
+			return res;
+		}
+		//! One dimensional Lagrange polynomial of node at c and its derivative.
+		static constexpr T lagrange(int c, T x, bool d) {
+			if (1 == nodes_::order) return d ? T(c)/T(2): (T(1)+T(c)*x)/T(2);
+			switch (c) {
+				case -1: return d ? x-T(0.5): x*(x-T(1))/T(2);
+				case 1: return d ? x+T(0.5): x*(x+T(1))/T(2);
+				default: return d ? -T(2)*x: T(1)-x*x;
+			}
+		}
+		/**
+		 *  \brief Shape function of node i or its derivative.
+		 *  \param [in] i index of node.
+		 *  \param [in] x natural coordinate.
+		 *  \param [in] jd direction of derivative, value is evaluated when jd equals dim.
+		 */
+		static constexpr T eval(size_t i, const point_ &x, size_t jd) {
+			const auto &c = nodes_::coord[i];
+			if (!nodes_::serendipity) {
+				T res{1};
+				for (size_t k = 0; k < dim; k++) res *= lagrange(c[k], x[k], k == jd);
+				return res;
+			}
+			size_t m{dim};
+			for (size_t k = 0; k < dim; k++) if (0 == c[k]) m = k;
+			if (dim == m) {
+				// Corner: prod(1+x*c)*(sum(x*c)-(D-1))/2^D.
+				T p{1}, s{-T(dim-1)}, dp{1};
+				for (size_t k = 0; k < dim; k++) {
+					p *= T(1)+x[k]*T(c[k]);
+					s += x[k]*T(c[k]);
+					dp *= k == jd ? T(c[k]): T(1)+x[k]*T(c[k]);
+				}
+				T res = dim == jd ? p*s: dp*s+p*T(c[jd]);
+				for (size_t k = 0; k < dim; k++) res /= T(2);
+				return res;
+			}
+			// Midside: (1-x_m^2)*prod_{k!=m}(1+x*c)/2^(D-1).
+			T res = m == jd ? -T(2)*x[m]: T(1)-x[m]*x[m];
+			for (size_t k = 0; k < dim; k++) {
+				if (k == m) continue;
+				res *= (k == jd ? T(c[k]): T(1)+x[k]*T(c[k]))/T(2);
+			}
+			return res;
+		}
+	};
+	/**
+	 *  \brief Shape functions tabulated at Gauss points.
+	 *  \tparam ST shape of element.
+	 *  \tparam NG number of Gauss points in each direction.
+	 *  \tparam T numerical type.
+	 */
+	template <ShapeType ST, size_t NG, class T = REAL8>
+	struct ShapeTable {
+		using func_ = ShapeFunction<ST, T>;
+		using rule_ = GaussRule<NG, func_::dim, T>;
+		static constexpr size_t num_node{func_::num_node};//!< Number of nodes.
+		static constexpr size_t dim{func_::dim};//!< Dimension.
+		static constexpr size_t num_point{rule_::size()};//!< Number of Gauss points.
+		rule_ rule{};//!< Gauss points and weights.
+		std::array<typename func_::value_, num_point> shp{};//!< Shape function at each point.
+		std::array<typename func_::deriv_, num_point> dshp{};//!< Derivative at each point.
+		//! Build table.
+		static constexpr ShapeTable make() {
+			ShapeTable res;
+			res.rule = gauss_rule_v<NG, dim, T>;
+			for (size_t g = 0; g < num_point; g++) {
+				res.shp[g] = func_::value(res.rule.pt[g]);
+				res.dshp[g] = func_::deriv(res.rule.pt[g]);
+			}
+			return res;
+		}
+	};
+	//! Shape table evaluated at compile time.
+	template <ShapeType ST, size_t NG, class T = REAL8>
+	inline constexpr ShapeTable<ST, NG, T> shape_table_v = ShapeTable<ST, NG, T>::make();
+}
+}
+#endif // CAFEA_SHAPE_FUNCTION_HPP_
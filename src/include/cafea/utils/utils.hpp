@@ -70,6 +70,15 @@ using matrix_ = Eigen::Matrix<U, Eigen::Dynamic, Eigen::Dynamic>;
 //! Complex matrix.
 template <class U = REAL8>
 using cmatrix_ = matrix_<COMPLEX<U>>;
+//! Fixed-size 3x3 matrix.
+template <class U = REAL8>
+using mat3_ = Eigen::Matrix<U, 3, 3>;
+//! Fixed-size square matrix.
+template <class U, int N>
+using matN_ = Eigen::Matrix<U, N, N>;
+//! Fixed-size vector.
+template <class U, int N>
+using vecN_ = Eigen::Matrix<U, N, 1>;
 //! Matlab style varargout with 2 return.
 //! Template aliases trick in C++11.
 template <class T = REAL8>
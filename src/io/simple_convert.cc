@@ -37,43 +37,9 @@ Node<T, U> AdapterF2Cpp<T, U>::f2node(const node_f03 *p_node) {
 template <class T, class U>
 Element<U> AdapterF2Cpp<T, U>::f2elem(const elem_f03 *p_elem) {
 	Element<U> elem = {p_elem->id_, p_elem->prop_[0], p_elem->prop_[1]};
-	int nn{0};
-	switch (p_elem->etype_) {
-		case 14:
-			elem.set_element_type(ElementType::COMBIN14);
-			nn = 2;
-			break;
-		case 16:
-			elem.set_element_type(ElementType::PIPE16);
-			nn = 2;
-			break;
-		case 18:
-			elem.set_element_type(ElementType::PIPE18);
-			nn = 3;
-			break;
-		case 21:
-			elem.set_element_type(ElementType::MASS21);
-			nn = 1;
-			break;
-		case 181:
-			elem.set_element_type(ElementType::SHELL181);
-			nn = 4;
-			break;
-		case 185:
-			elem.set_element_type(ElementType::SOLID185);
-			nn = 8;
-			break;
-		case 186:
-			elem.set_element_type(ElementType::SOLID186);
-			nn = 20;
-			break;
-		case 281:
-			elem.set_element_type(ElementType::SHELL281);
-			nn = 8;
-			break;
-		default: elem.set_element_type(ElementType::UNKNOWN);
-	}
-	if (0 < nn) elem.set_node_list(&p_elem->node_list_[0], nn);
+	elem.set_element_type(p_elem->etype_);
+	auto nn = ElementAttr::get_num_of_node(elem.get_element_type());
+	if (0 < nn) elem.set_node_list(&p_elem->node_list_[0], static_cast<int>(nn));
 	elem.set_option(&p_elem->opt_[0], 10);
 	return elem;
 }
@@ -134,43 +100,9 @@ Node<T, U> AdapterF2Cpp<T, U>::bcy2node(const node_bcy *p) {
 template <class T, class U>
 Element<U> AdapterF2Cpp<T, U>::bcy2elem(const elem_bcy *p) {
 	Element<U> elem {p->id_, p->mtype_, p->stype_};
-	int nn{0};
-	switch (p->etype_) {
-		case 14:
-			elem.set_element_type(ElementType::COMBIN14);
-			nn = 2;
-			break;
-		case 16:
-			elem.set_element_type(ElementType::PIPE16);
-			nn = 2;
-			break;
-		case 18:
-			elem.set_element_type(ElementType::PIPE18);
-			nn = 3;
-			break;
-		case 21:
-			elem.set_element_type(ElementType::MASS21);
-			nn = 1;
-			break;
-		case 181:
-			elem.set_element_type(ElementType::SHELL181);
-			nn = 4;
-			break;
-		case 185:
-			elem.set_element_type(ElementType::SOLID185);
-			nn = 8;
-			break;
-		case 186:
-			elem.set_element_type(ElementType::SOLID186);
-			nn = 20;
-			break;
-		case 281:
-			elem.set_element_type(ElementType::SHELL281);
-			nn = 8;
-			break;
-		default: elem.set_element_type(ElementType::UNKNOWN);
-	}
-	if (0 < nn) elem.set_node_list(&p->node_list_[0], nn);
+	elem.set_element_type(p->etype_);
+	auto nn = ElementAttr::get_num_of_node(elem.get_element_type());
+	if (0 < nn) elem.set_node_list(&p->node_list_[0], static_cast<int>(nn));
 	return elem;
 }
 /**
@@ -38,6 +38,11 @@ void SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::clear() {
 	if (!this->bc_group_.empty()) this->bc_group_.clear();
 	if (!this->load_group_.empty()) this->load_group_.clear();
 	this->mat_pair_.clear();
+	this->dof_table_.clear();
+	this->conn_.clear();
+	this->dof_part_.clear();
+	this->elem_env_.clear();
+	this->node_env_.clear();
 
 	fmt::print("This is harmonic clear.\n");
 	// fmt::print("Damping size{}\n", this->damping_.size());
@@ -78,16 +83,16 @@ void SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::check() {
  */
 template <class FileReader, class Scalar, class ResultScalar>
 void SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::analyze() {
-	for (const auto &it: (*this).elem_group_) {
-		const auto &p_elem = it.second;//!< Get element ptr.
-		auto node_list = p_elem.get_node_list();
-		auto et = p_elem.get_element_type();
+	if (this->conn_.get_num_elem() != this->elem_group_.size()) this->init_connectivity();
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		const auto &p_elem = this->elem_group_.value(e);
+		const auto et = p_elem.get_element_type();
+		const int *node = this->conn_.get_node(e);
 		for (int i = 0; i < p_elem.get_active_num_of_node(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) {
-				got->second.activate(true);
-				got->second.dof_init(et);
-			}
+			if (0 > node[i]) continue;
+			auto &p_node = this->node_group_.value(static_cast<size_t>(node[i]));
+			p_node.activate(true);
+			p_node.dof_init(et);
 		}
 	}
 	for (const auto &bc: (*this).bc_group_) {
@@ -96,39 +101,17 @@ void SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::analyze() {
 			got->second.dof_apply(bc);
 		}
 	}
-	int num{0};
-	for (auto &it: this->node_group_) it.second.dof_accum(&num, DofType::NORMAL);
+	int num = this->init_dof_table();
 
 	fmt::print("Total Dimension:{}\n", num);
 
-	for (const auto &it: this->elem_group_) {
-		const auto &p_elem = it.second;
-		auto node_list = p_elem.get_node_list();
-		auto num = p_elem.get_active_num_of_node();
-		for (int i = 0; i < num; i++) {
-			auto got_i = this->node_group_.find(node_list[i]);
-			if (got_i != this->node_group_.end()) {
-				auto dof_i = got_i->second.dof_list();
-				for (int j = 0; j < num; j++) {
-					auto got_j = this->node_group_.find(node_list[j]);
-						if (got_j != this->node_group_.end()) {
-							auto dof_j = got_j->second.dof_list();
-							for (auto ia: dof_i) {
-								if (ia >= 0) {
-									for (auto ib: dof_j) {
-										if (ib >= 0) this->mat_pair_.append(ia, ib);
-									}
-								}
-							}
-						}
-				}
-			}
-		}
-	}
+	this->init_pattern();
 	this->mat_pair_.unique();
 	fmt::print("Non Zeros: {}\n", this->mat_pair_.get_nnz());
 	fmt::print("Dimension: {}\n", this->mat_pair_.get_dim());
 
+	this->init_partition(this->load_group_);
+
 	this->rhs_cmplx_.resize(this->mat_pair_.get_dim(), this->load_group_.size());
 	this->disp_cmplx_.resize(this->mat_pair_.get_dim(), this->load_group_.size());
 	this->rhs_cmplx_.fill(COMPLEX<ResultScalar>(0.0, 0.0));
@@ -152,55 +135,51 @@ void SolutionHarmonicFull<FileReader, Scalar, ResultScalar>::assembly() {
 			if (!y.empty()) pres.push_back(y[0]);
 		}
 	}
-	for (auto &it: this->elem_group_) {
-		auto &p_elem = it.second;
+	const auto req = this->get_eval_request();
+	std::vector<const int*> node_dofs;
+	typename SolutionStatic<FileReader, Scalar, ResultScalar>::node_view_ pt;
+	cmatrix_<ResultScalar> p_rhs_cmplx;
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		auto &p_elem = this->elem_group_.value(e);
 		p_elem.set_lumped_mass(lumped);
-		auto node_list = p_elem.get_node_list();
-		auto mt = p_elem.get_material_id();
-		auto st = p_elem.get_section_id();
-		auto got_mt = this->matl_group_.find(mt);
-		auto got_st = this->sect_group_.find(st);
-		assert(got_mt != this->matl_group_.end());
-		assert(got_st != this->sect_group_.end());
-		Node<Scalar, ResultScalar> pt[node_list.size()];
-		for (size_t i = 0; i < node_list.size(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) pt[i] = got->second;
-		}
-		// p_elem.template form_matrix<Scalar>(pt, &(got_mt->second), &(got_st->second));
-		p_elem.template form_matrix<Scalar>(pt, &(got_mt->second), &(got_st->second), pres);
-		auto p_stif = p_elem.get_stif();
-		auto p_mass = p_elem.get_mass();
-		auto p_tran = p_elem.get_tran();
-		auto p_rhs = p_elem.get_rhs();
-		auto p_rhs_cmplx = p_elem.get_rhs_cmplx();
+		p_elem.set_eval_request(req);
+		p_elem.set_single_precision(this->single_kernel_);
+		assert(0 <= this->conn_.get_material(e));
+		assert(0 <= this->conn_.get_section(e));
+		const auto &p_matl = this->matl_group_.value(static_cast<size_t>(this->conn_.get_material(e)));
+		const auto &p_sect = this->sect_group_.value(static_cast<size_t>(this->conn_.get_section(e)));
+		this->get_node_view(e, pt);
+		// p_elem.template form_matrix<Scalar>(pt, &p_matl, &p_sect);
+		p_elem.template form_matrix<Scalar>(pt.data(), &p_matl, &p_sect, pres);
+		this->get_node_dofs(e, node_dofs);
 		// if(p_elem.get_element_type_id()==16)std::cout << p_rhs_cmplx << "\n";
 		// if(p_elem.get_element_type_id()==18)std::cout << p_rhs_cmplx << "\n";
-		p_stif = p_tran.transpose()*p_stif*p_tran;
-		p_mass = p_tran.transpose()*p_mass*p_tran;
-		p_rhs = p_tran.transpose()*p_rhs;
-		p_rhs_cmplx = p_tran.transpose()*p_rhs_cmplx;
+		p_rhs_cmplx.noalias() = p_elem.get_tran().transpose()*p_elem.get_rhs_cmplx();
 
 		auto nn = p_elem.get_active_num_of_node();
 		auto ndof = p_elem.get_dofs_per_node();
-		for (auto ia = 0; ia < nn; ia++) {
-			auto va = pt[ia].dof_list();
-			for (auto ja = 0; ja < ndof; ja++) {
-				p_elem.set_element_dofs(va[ja]);
-				if (va[ja] < 0) continue;
-				auto row_ = ia*ndof+ja;
-				// this->mat_pair_.add_rhs_data(va[ja], p_rhs(row_));
-				this->rhs_cmplx_.row(va[ja]) += p_rhs_cmplx.row(row_);
-				for (auto ib = 0; ib < nn; ib++) {
-					auto vb = pt[ib].dof_list();
-					for (auto jb = 0; jb < ndof; jb++) {
-						if (vb[jb] < 0) continue;
-						auto col_ = ib*ndof+jb;
-						this->mat_pair_.add_matrix_data(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+		p_elem.clear_element_dofs();
+		this->visit_element_matrix(p_elem, [&] (const auto &p_stif, const auto &p_mass, const auto &) {
+			for (size_t ia = 0; ia < nn; ia++) {
+				const int *va = node_dofs[ia];
+				for (size_t ja = 0; ja < ndof; ja++) {
+					p_elem.set_element_dofs(nullptr == va ? -1: va[ja]);
+					if (nullptr == va || va[ja] < 0) continue;
+					auto row_ = ia*ndof+ja;
+					// this->mat_pair_.add_rhs_data(va[ja], p_rhs(row_));
+					this->rhs_cmplx_.row(va[ja]) += p_rhs_cmplx.row(row_);
+					for (size_t ib = 0; ib < nn; ib++) {
+						const int *vb = node_dofs[ib];
+						if (nullptr == vb) continue;
+						for (size_t jb = 0; jb < ndof; jb++) {
+							if (vb[jb] < 0) continue;
+							auto col_ = ib*ndof+jb;
+							this->mat_pair_.add_matrix_data(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+						}
 					}
 				}
 			}
-		}
+		});
 	}
 }
 
@@ -242,12 +221,16 @@ void SolutionHarmonicFull<FileReader, T, U>::solve() {
 	}
 	mat_M.setFromTriplets(triList.begin(), triList.end());
 	triList.clear();
+	// Free-free and free-prescribed blocks keep the same pattern in all frequencies.
+	const auto &part = this->dof_part_;
+	Eigen::SparseMatrix<COMPLEX<U>> mat_K_ff = part.get_ff(mat_K), mat_M_ff = part.get_ff(mat_M);
+	Eigen::SparseMatrix<COMPLEX<U>> mat_K_fp = part.get_fp(mat_K), mat_M_fp = part.get_fp(mat_M);
 	fmt::print("Begin iteration.\n");
 	for (int i = 0; i < this->freq_range_.size(); i++) {
 		fmt::print("Iter No. {}\tFrequency: {}\n", i+1, this->freq_range_(i));
 		auto omega = 2.*PI<U>()*this->freq_range_(i);
 		auto omega2 = omega*omega;
-		Eigen::SparseMatrix<COMPLEX<U>> mat_a = mat_K - (omega2+0.0i)*mat_M;
+		Eigen::SparseMatrix<COMPLEX<U>> mat_a = mat_K_ff - (omega2+0.0i)*mat_M_ff;
 		// solver.analyzePattern(mat_a);
 		// solver.factorize(mat_a);
 		solver.compute(mat_a);
@@ -257,54 +240,33 @@ void SolutionHarmonicFull<FileReader, T, U>::solve() {
 			fmt::print("Decomposition Success!\n");
 		}
 		vecX_<COMPLEX<U>> rhs = this->rhs_cmplx_.col(i);
-		auto force = this->load_group_[i].get_load_by_type(LoadType::FORCE);
-		if (!force.empty()) {
-			for (auto const &x: force) {
-				auto got = this->node_group_.find(x.get_id());
-				auto dof_label = static_cast<int>(x.get_dof_label());
-				COMPLEX<U> force_val = x.val_cmplx_;
-				if (got != this->node_group_.end()) {
-					auto &pt = got->second;
-					auto va = pt.dof_list();
-					if (dof_label < va.size()) {
-						if (0 <= va[dof_label]) rhs(va[dof_label]) += force_val;
-					}
-				}
-			}
-		}
-		auto disp = this->load_group_[i].get_load_by_type(LoadType::DISP);
-		if (!disp.empty()) {
-			for (auto const &x: disp) {
-				auto got = this->node_group_.find(x.get_id());
-				int dof_label = static_cast<int>(x.get_dof_label());
-				COMPLEX<U> disp_val = x.val_cmplx_;
-				if (got != this->node_group_.end()) {
-					auto &pt = got->second;
-					auto va = pt.dof_list();
-					if (dof_label < va.size()) {
-						auto index = va[dof_label];
-						if (0 <= index) {
-							mat_a.coeffRef(index, index) *= 1.e30;
-							rhs(index) = disp_val*mat_a.coeff(index, index);
-						}
-					}
-				}
-			}
-		}
-		this->disp_cmplx_.col(i) = solver.solve(rhs);
+		this->add_force(this->load_group_[i], rhs);
+		vecX_<COMPLEX<U>> u_p = this->template get_prescribed_value<COMPLEX<U>>(this->load_group_[i]);
+		Eigen::SparseMatrix<COMPLEX<U>> mat_a_fp = mat_K_fp - (omega2+0.0i)*mat_M_fp;
+		vecX_<COMPLEX<U>> x_f = solver.solve(part.get_rhs(rhs, mat_a_fp, u_p));
+		this->disp_cmplx_.col(i) = part.expand(x_f, u_p);
 
 		if (solver.info() != Eigen::ComputationInfo::Success) {
 			fmt::print("Solve Failed!\n");
 		} else {
-			fmt::print("Solve Success!\n");
+			fmt::print("Solve Success! Iterations: {}\n", solver.iterations());
 		}
 	}
+	this->set_node_disp();
+	fmt::print("Harmonic full solve.\n");
+}
+
+/**
+ *  \brief Set nodal displacement from global solution.
+ */
+template <class FileReader, class T, class U>
+void SolutionHarmonicFull<FileReader, T, U>::set_node_disp() {
 	for (auto &it: this->node_group_) {
 		auto &p_node = it.second;
 		auto num_step = this->freq_range_.size();
 		if (p_node.is_activated()) {
 			p_node.init_result(SolutionType::HARMONIC_FULL, num_step);
-			auto tmp = p_node.dof_list();
+			const auto &tmp = p_node.dof_list();
 			matrix_<COMPLEX<U>> x = matrix_<COMPLEX<U>>::Zero(tmp.size(), num_step);
 			for (int i = 0; i < tmp.size(); i++) {
 				if (tmp[i] >= 0) x.row(i) = this->disp_cmplx_.row(tmp[i]);
@@ -313,7 +275,6 @@ void SolutionHarmonicFull<FileReader, T, U>::solve() {
 		}
 		// fmt::print("Set displace result finish.\n");
 	}
-	fmt::print("Harmonic full solve.\n");
 }
 
 /**
@@ -337,7 +298,7 @@ void SolutionHarmonicFull<FileReader, T, U>::load(const char* fn) {
 		for (int i = 0; i < info["node"]; i++, p_node++) {
 			auto got = this->node_group_.find(p_node->id_);
 			if (got == this->node_group_.end()) {
-				this->node_group_[p_node->id_] = f2cpp.bcy2node(p_node);
+				this->node_group_.emplace(p_node->id_, f2cpp.bcy2node(p_node));
 			} else {
 				fmt::print("Duplicated node id:{}\n", p_node->id_);
 			}
@@ -346,7 +307,7 @@ void SolutionHarmonicFull<FileReader, T, U>::load(const char* fn) {
 		for (int i = 0; i < info["element"]; i++, p_elem++) {
 			auto got = this->elem_group_.find(p_elem->id_);
 			if (got == this->elem_group_.end()) {
-				this->elem_group_[p_elem->id_] = f2cpp.bcy2elem(p_elem);
+				this->elem_group_.emplace(p_elem->id_, f2cpp.bcy2elem(p_elem));
 			} else {
 				fmt::print("Duplicated element id:{}\n", p_elem->id_);
 			}
@@ -355,7 +316,7 @@ void SolutionHarmonicFull<FileReader, T, U>::load(const char* fn) {
 		for (int i = 0; i < info["material"]; i++, p_matl++) {
 			auto got = this->matl_group_.find(p_matl->id_);
 			if (got == this->matl_group_.end()) {
-				this->matl_group_[p_matl->id_] = f2cpp.bcy2matl(p_matl);
+				this->matl_group_.emplace(p_matl->id_, f2cpp.bcy2matl(p_matl));
 			} else {
 				fmt::print("Duplicated material id:{}\n", p_matl->id_);
 			}
@@ -366,7 +327,7 @@ void SolutionHarmonicFull<FileReader, T, U>::load(const char* fn) {
 			if (got == this->sect_group_.end()) {
 				auto st = f2cpp.bcy2sect(p_sect);
 				st.set_sect_prop(SectionProp::PRESIN, T(1));
-				this->sect_group_[p_sect->id_] = st;
+				this->sect_group_.emplace(p_sect->id_, st);
 			} else {
 				fmt::print("Duplicated section id:{}\n", p_sect->id_);
 			}
@@ -422,42 +383,132 @@ void SolutionHarmonicFull<FileReader, T, U>::load(const char* fn) {
 			}
 			this->load_group_.push_back(tmp_frame);
 		}
+		this->init_connectivity();
 	}
 }
 /**
  *  \brief Post-process.
+ *
+ *  Element stresses of all frequencies are evaluated in parallel, only rows
+ *  of result request are kept. Then each node takes SEQV from the last
+ *  element sharing it, same as overwriting in order of elements, and nodes
+ *  are written in parallel without lock. Points not requested are zero.
  */
 template <class FileReader, class T, class U>
 void SolutionHarmonicFull<FileReader, T, U>::post_process() {
-	fmt::print("Empty\n");
-	auto num_step = this->freq_range_.size();
-	for (auto &it: this->elem_group_) {
-		auto &p_elem = it.second;
-		auto va = p_elem.get_element_dofs();
+	const int num_step = static_cast<int>(this->freq_range_.size());
+	// Elements and their activated nodes.
+	std::vector<Element<U>*> elem_list;
+	std::vector<std::vector<int>> elem_node;
+	elem_list.reserve(this->elem_group_.size());
+	elem_node.reserve(this->elem_group_.size());
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		elem_list.push_back(&this->elem_group_.value(e));
+		elem_node.emplace_back();
+		const int *node = this->conn_.get_node(e);
+		for (size_t i = 0; i < this->conn_.get_num_node(e); i++) {
+			if (0 > node[i]) continue;
+			const auto &p_node = this->node_group_.value(static_cast<size_t>(node[i]));
+			if (p_node.is_activated()) elem_node.back().push_back(p_node.get_id());
+		}
+	}
+	if (this->envelope_only_) return this->post_envelope(elem_list, elem_node);
+	NodalScatter::for_each(elem_list.size(), [&] (size_t k) {
+		auto &p_elem = *elem_list[k];
+		p_elem.set_result_request(this->result_req_);
+		const auto &va = p_elem.get_element_dofs();
 		matrix_<COMPLEX<U>> x = matrix_<COMPLEX<U>>::Zero(va.size(), num_step);
 		for (int i = 0; i < va.size(); i++) {
 			if (va[i] >= 0) x.row(i) = this->disp_cmplx_.row(va[i]);
 		}
-		// std::cout << "Element displacement: " << x.col(0) << "\n";
 		p_elem.template post_stress<COMPLEX<U>>(x);
-		matrix_<COMPLEX<U>> stress = p_elem.template get_result<COMPLEX<U>>();
-		if (1 > stress.rows()) continue;
-		// fmt::print("Stress Row:{} Col:{}\n", stress.rows(), stress.cols());
-		auto node_list = p_elem.get_node_list();
-		auto nn = p_elem.get_active_num_of_node();
-		auto iter{0};
-		for (auto &i: node_list) {
-			auto &p_node = this->node_group_[i];
-			if (p_node.is_activated()) {
-				for (int j = 0; j < num_step; j++) {
-					// fmt::print("Col index:{}\n", j*int(nn)+iter);
-					matrix_<COMPLEX<U>> yy = stress.block(43, j*static_cast<int>(nn)+iter, 8, 1);
-					p_node.template set_result<COMPLEX<U>>(SolutionType::HARMONIC_FULL, LoadType::STRESS, j, yy);
+	});
+	if (!has_request(this->result_req_.get_quantity(), PipeResult::SEQV)) return;
+	std::array<int, ResultRequest::num_point> seqv;
+	for (int j = 0; j < ResultRequest::num_point; j++) seqv[j] = this->result_req_.get_row(PipeResult::SEQV, j);
+	NodalScatter scatter;
+	scatter.init(elem_node);
+	std::vector<Node<T, U>*> node_list(scatter.get_num_node());
+	for (size_t i = 0; i < node_list.size(); i++) node_list[i] = &this->node_group_.at(scatter.get_node_id(i));
+	scatter.for_each_node([&] (size_t i) {
+		for (size_t j = scatter.get_num_share(i); 0 < j; j--) {
+			const auto &s = scatter.get_share(i, j-1);
+			const auto &stress = elem_list[s.elem]->get_result_cmplx();
+			if (1 > stress.rows()) continue;
+			const int nn = static_cast<int>(elem_list[s.elem]->get_active_num_of_node());
+			for (int k = 0; k < num_step; k++) {
+				matrix_<COMPLEX<U>> yy = matrix_<COMPLEX<U>>::Zero(8, 1);
+				for (int r = 0; r < ResultRequest::num_point; r++) {
+					if (0 <= seqv[r]) yy(r) = stress(seqv[r], k*nn+s.pos);
 				}
-				iter++;
+				node_list[i]->template set_result<COMPLEX<U>>(SolutionType::HARMONIC_FULL, LoadType::STRESS, k, yy);
 			}
+			break;
+		}
+	});
+}
+
+/**
+ *  \brief Post-process keeping envelopes only.
+ *  \param[in] elem_list elements.
+ *  \param[in] elem_node activated nodes of elements.
+ *
+ *  Each node is owned by the last element with stress sharing it, same as
+ *  post_process(). Results of all frequencies of an element are reduced to
+ *  its envelope and envelopes of its owned nodes by the same thread, then
+ *  released, so neither element nor nodal history is stored. Steps of
+ *  envelopes are indices of freq_range_.
+ */
+template <class FileReader, class T, class U>
+void SolutionHarmonicFull<FileReader, T, U>::post_envelope(const std::vector<Element<U>*> &elem_list,
+	std::vector<std::vector<int>> elem_node) {
+	const int num_step = static_cast<int>(this->freq_range_.size());
+	const int nr = this->result_req_.get_num_row();
+	int nn_max{0};
+	std::vector<int> elem_id(elem_list.size());
+	for (size_t k = 0; k < elem_list.size(); k++) {
+		elem_id[k] = elem_list[k]->get_element_id();
+		if (ElementAttr::has_stress(elem_list[k]->get_element_type())) {
+			nn_max = std::max(nn_max, static_cast<int>(elem_list[k]->get_active_num_of_node()));
+		} else {
+			elem_node[k].clear();
 		}
 	}
+	NodalScatter scatter;
+	scatter.init(elem_node);
+	// Owned nodes of elements, position in element and index of node.
+	std::vector<std::vector<std::pair<int, size_t>>> own(elem_list.size());
+	std::vector<int> node_id(scatter.get_num_node());
+	for (size_t i = 0; i < node_id.size(); i++) {
+		const auto &s = scatter.get_share(i, scatter.get_num_share(i)-1);
+		own[s.elem].emplace_back(s.pos, i);
+		node_id[i] = scatter.get_node_id(i);
+	}
+	this->elem_env_.init(elem_id, nr*nn_max);
+	this->node_env_.init(node_id, nr);
+	NodalScatter::for_each(elem_list.size(), [&] (size_t k) {
+		auto &p_elem = *elem_list[k];
+		if (!ElementAttr::has_stress(p_elem.get_element_type())) return;
+		p_elem.set_result_request(this->result_req_);
+		const auto &va = p_elem.get_element_dofs();
+		matrix_<COMPLEX<U>> x = matrix_<COMPLEX<U>>::Zero(va.size(), num_step);
+		for (int i = 0; i < va.size(); i++) {
+			if (va[i] >= 0) x.row(i) = this->disp_cmplx_.row(va[i]);
+		}
+		p_elem.template post_stress<COMPLEX<U>>(x);
+		const auto &stress = p_elem.get_result_cmplx();
+		const auto m = stress.rows();
+		const auto nn = static_cast<Eigen::Index>(p_elem.get_active_num_of_node());
+		if (0 < m) {
+			// Columns of a frequency are contiguous, so rows of nodes are stacked.
+			this->elem_env_.update(k, 0, Eigen::Map<const cmatrix_<U>>(stress.data(), m*nn, num_step));
+			for (const auto &it: own[k]) {
+				this->node_env_.update(it.second, 0, Eigen::Map<const cmatrix_<U>, 0, Eigen::OuterStride<>>(
+					stress.data()+it.first*m, m, num_step, Eigen::OuterStride<>(m*nn)));
+			}
+		}
+		p_elem.clear_result();
+	});
 }
 
 /**
@@ -664,6 +715,8 @@ void SolutionHarmonicFull<FP, T, U>::set_parameter(SolutionOption chk, bool val)
 	switch (chk) {
 		case SolutionOption::LUMPED_MASS: this->set_mass_lumped(val); break;
 		case SolutionOption::PRESSURE_INTERNAL: this->has_pressure_ = val; break;
+		case SolutionOption::SINGLE_PRECISION_KERNEL: this->set_single_precision(val); break;
+		case SolutionOption::RESULT_ENVELOPE: this->set_envelope_only(val); break;
 		default: fmt::print("Unsupport boolean parameter in modal analyze.\n");
 	}
 }
@@ -0,0 +1,69 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include "cafea/cafea.h"
+
+namespace cafea {
+/**
+ *  \brief Solve harmonic response by reduced order model.
+ *
+ *  Global K, M and structural damping from assembly() are reduced once
+ *  in the whole frequency band, then each frequency is a dense solve
+ *  of reduced dimension.
+ */
+template <class FileReader, class T, class U>
+void SolutionHarmonicKrylov<FileReader, T, U>::solve() {
+	auto num_step = this->freq_range_.size();
+	if (1 > num_step) {
+		fmt::print("None frequency in harmonic analysis.\n");
+		return;
+	}
+	for (auto &p: this->load_group_) {
+		if (!p.get_load_by_type(LoadType::DISP).empty()) {
+			fmt::print("Prescribed displacement is not reduced, switch to full method.\n");
+			SolutionHarmonicFull<FileReader, T, U>::solve();
+			return;
+		}
+	}
+	auto dim = this->mat_pair_.get_dim();
+	Eigen::SparseMatrix<U> mat_K = this->get_global_matrix(), mat_M = this->get_global_matrix(true);
+
+	matrix_<COMPLEX<U>> rhs = this->rhs_cmplx_;
+	for (int i = 0; i < num_step; i++) {
+		vecX_<COMPLEX<U>> rhs_i = rhs.col(i);
+		this->add_force(this->load_group_[i], rhs_i);
+		rhs.col(i) = rhs_i;
+	}
+
+	this->reducer_.load(mat_K, mat_M, this->damping_[0]);
+	this->reducer_.set_rhs(rhs);
+	bool flag = this->reducer_.reduce(this->freq_range_.minCoeff(), this->freq_range_.maxCoeff(),
+		this->tol_, this->num_moment_, this->max_point_, std::max(64, 4*static_cast<int>(num_step)));
+	if (!flag) fmt::print("Reduced model does not reach tolerance: {}\n", this->tol_);
+	fmt::print("Reduced dimension: {} of {}\n", this->reducer_.get_dim(), dim);
+
+	for (int i = 0; i < num_step; i++) {
+		this->disp_cmplx_.col(i) = this->reducer_.solve(this->freq_range_(i), i);
+	}
+	this->set_node_disp();
+	fmt::print("Harmonic Krylov solve.\n");
+}
+
+/**
+ *  \brief Set solution parameter.
+ */
+template <class FP, class T, class U>
+void SolutionHarmonicKrylov<FP, T, U>::set_parameter(SolutionOption chk, init_list_<U> val) {
+	for (auto p: val) {
+		switch (chk) {
+			case SolutionOption::KRYLOV_MOMENT: this->num_moment_ = std::max(1, static_cast<int>(p)); break;
+			case SolutionOption::KRYLOV_TOLERANCE: this->tol_ = p; break;
+			case SolutionOption::KRYLOV_POINT: this->max_point_ = std::max(1, static_cast<int>(p)); break;
+			default: SolutionHarmonicFull<FP, T, U>::set_parameter(chk, val); return;
+		}
+	}
+}
+}  // namespace cafea
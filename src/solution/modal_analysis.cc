@@ -27,6 +27,7 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::clear() {
 	if (!this->sect_group_.empty()) this->sect_group_.clear();
 	if (!this->bc_group_.empty()) this->bc_group_.clear();
 	this->mat_pair_.clear();
+	this->conn_.clear();
 	if (this->solver_) this->solver_.reset(nullptr);
 	if (0 < this->mode_shape_.rows()) (*this).mode_shape_.resize(0, 0);
 	if (0 < this->natural_freq_.rows()) (*this).natural_freq_.resize(0, 0);
@@ -59,16 +60,16 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::check() {
  */
 template <class FileReader, class Scalar, class ResultScalar>
 void SolutionModal<FileReader, Scalar, ResultScalar>::analyze() {
-	for (const auto &it: (*this).elem_group_) {
-		const auto &p_elem = it.second;//!< Get element ptr.
-		auto node_list = p_elem.get_node_list();
-		auto et = p_elem.get_element_type();
+	if (this->conn_.get_num_elem() != this->elem_group_.size()) this->init_connectivity();
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		const auto &p_elem = this->elem_group_.value(e);
+		const auto et = p_elem.get_element_type();
+		const int *node = this->conn_.get_node(e);
 		for (int i = 0; i < p_elem.get_active_num_of_node(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) {
-				got->second.activate(true);
-				got->second.dof_init(et);
-			}
+			if (0 > node[i]) continue;
+			auto &p_node = this->node_group_.value(static_cast<size_t>(node[i]));
+			p_node.activate(true);
+			p_node.dof_init(et);
 		}
 	}
 	for (const auto &bc: (*this).bc_group_) {
@@ -77,35 +78,11 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::analyze() {
 			got->second.dof_apply(bc);
 		}
 	}
-	int num{0};
-	for (auto &it: this->node_group_) it.second.dof_accum(&num, DofType::NORMAL);
+	int num = this->init_dof_table();
 
 	fmt::print("Total Dimension:{}\n", num);
 
-	for (const auto &it: this->elem_group_) {
-		const auto &p_elem = it.second;
-		auto node_list = p_elem.get_node_list();
-		auto num = p_elem.get_active_num_of_node();
-		for (int i = 0; i < num; i++) {
-			auto got_i = this->node_group_.find(node_list[i]);
-			if (got_i != this->node_group_.end()) {
-				auto dof_i = got_i->second.dof_list();
-				for (int j = 0; j < num; j++) {
-					auto got_j = this->node_group_.find(node_list[j]);
-						if (got_j != this->node_group_.end()) {
-							auto dof_j = got_j->second.dof_list();
-							for (auto ia: dof_i) {
-								if (ia >= 0) {
-									for (auto ib: dof_j) {
-										if (ib >= 0) this->mat_pair_.append(ia, ib);
-									}
-								}
-							}
-						}
-				}
-			}
-		}
-	}
+	this->init_pattern();
 	this->mat_pair_.unique();
 	fmt::print("Non Zeros: {}\n", this->mat_pair_.get_nnz());
 	fmt::print("Dimension: {}\n", this->mat_pair_.get_dim());
@@ -118,45 +95,45 @@ template <class FileReader, class Scalar, class ResultScalar>
 void SolutionModal<FileReader, Scalar, ResultScalar>::assembly() {
 	bool lumped{false};
 	if (this->mass_type_ == MassType::LUMPED) lumped = true;
-	for (auto &it: this->elem_group_) {
-		auto &p_elem = it.second;
+	this->open_element_cache();
+	const auto req = this->get_eval_request();
+	std::vector<const int*> node_dofs;
+	typename SolutionStatic<FileReader, Scalar, ResultScalar>::node_view_ pt;
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		auto &p_elem = this->elem_group_.value(e);
 		p_elem.set_lumped_mass(lumped);
-		auto node_list = p_elem.get_node_list();
-		auto mt = p_elem.get_material_id();
-		auto st = p_elem.get_section_id();
-		auto got_mt = this->matl_group_.find(mt);
-		auto got_st = this->sect_group_.find(st);
-		assert(got_mt != this->matl_group_.end());
-		assert(got_st != this->sect_group_.end());
-		Node<Scalar, ResultScalar> pt[node_list.size()];
-		for (size_t i = 0; i < node_list.size(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) pt[i] = got->second;
-		}
-		p_elem.template form_matrix<Scalar>(pt, &(got_mt->second), &(got_st->second));
-		auto p_stif = p_elem.get_stif();
-		auto p_mass = p_elem.get_mass();
-		auto p_tran = p_elem.get_tran();
-		p_stif = p_tran.transpose()*p_stif*p_tran;
-		p_mass = p_tran.transpose()*p_mass*p_tran;
+		p_elem.set_eval_request(req);
+		p_elem.set_single_precision(this->single_kernel_);
+		assert(0 <= this->conn_.get_material(e));
+		assert(0 <= this->conn_.get_section(e));
+		const auto &p_matl = this->matl_group_.value(static_cast<size_t>(this->conn_.get_material(e)));
+		const auto &p_sect = this->sect_group_.value(static_cast<size_t>(this->conn_.get_section(e)));
+		this->get_node_view(e, pt);
+		this->form_element(p_elem, pt.data(), &p_matl, &p_sect);
+		this->get_node_dofs(e, node_dofs);
 		auto nn = p_elem.get_active_num_of_node();
 		auto ndof = p_elem.get_dofs_per_node();
-		for (size_t ia = 0; ia < nn; ia++) {
-			auto va = pt[ia].dof_list();
-			for (auto ja = 0; ja < ndof; ja++) {
-				if (va[ja] < 0) continue;
-				for (size_t ib = 0; ib < nn; ib++) {
-					auto vb = pt[ib].dof_list();
-					for (auto jb = 0; jb < ndof; jb++) {
-						if (vb[jb] < 0) continue;
-						auto row_ = ia*ndof+ja;
-						auto col_ = ib*ndof+jb;
-						this->mat_pair_.add_matrix_data_KM(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+		this->visit_element_matrix(p_elem, [&] (const auto &p_stif, const auto &p_mass, const auto &) {
+			for (size_t ia = 0; ia < nn; ia++) {
+				const int *va = node_dofs[ia];
+				if (nullptr == va) continue;
+				for (size_t ja = 0; ja < ndof; ja++) {
+					if (va[ja] < 0) continue;
+					for (size_t ib = 0; ib < nn; ib++) {
+						const int *vb = node_dofs[ib];
+						if (nullptr == vb) continue;
+						for (size_t jb = 0; jb < ndof; jb++) {
+							if (vb[jb] < 0) continue;
+							auto row_ = ia*ndof+ja;
+							auto col_ = ib*ndof+jb;
+							this->mat_pair_.add_matrix_data_KM(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+						}
 					}
 				}
 			}
-		}
+		});
 	}
+	this->close_element_cache();
 }
 
 /**
@@ -194,7 +171,7 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::solve() {
 			auto &p_node = it.second;
 			p_node.init_result(SolutionType::MODAL, val.rows());
 			if (p_node.is_activated()) {
-				auto tmp = p_node.dof_list();
+				const auto &tmp = p_node.dof_list();
 				matrix_<ResultScalar> x = matrix_<ResultScalar>::Zero(tmp.size(), val.rows());
 				for (int i = 0; i < x.rows(); i++) {
 					if (0 <= tmp[i]) x.row(i) = shp.row(tmp[i]);
@@ -230,9 +207,9 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::write2mat(const char* fnam
 		fmt::print("Error creating MAT file\n");
 		return;
 	}
-	const size_t nfields{8};
+	const size_t nfields{9};
 	const char *fieldnames[nfields] = {"id", "etype", "mtype", "stype", "nodes",
-		"stif", "mass", "tran"};
+		"stif", "mass", "tran", "attr"};
 	size_t elem_dims[2] = {this->elem_group_.size(), 1};
 	matvar_t *elem_list = Mat_VarCreateStruct("elem", 2, elem_dims, fieldnames, nfields);
 
@@ -259,6 +236,16 @@ void SolutionModal<FileReader, Scalar, ResultScalar>::write2mat(const char* fnam
 			sz.data(), const_cast<ResultScalar*>(it.second.get_mass_ptr()), MAT_F_DONT_COPY_DATA);
 		matvar[7] = Mat_VarCreate(fieldnames[7], MAT_C_DOUBLE, MAT_T_DOUBLE, 2,
 			sz.data(), const_cast<ResultScalar*>(it.second.get_tran_ptr()), MAT_F_DONT_COPY_DATA);
+		// String keyed view of properties is only built for export.
+		auto prop = it.second.get_property().to_map();
+		std::vector<const char*> prop_names;
+		for (const auto &p: prop) prop_names.push_back(p.first.c_str());
+		matvar[8] = Mat_VarCreateStruct(fieldnames[8], 2, dim1x1, prop_names.data(), prop_names.size());
+		for (const auto &p: prop) {
+			double v = static_cast<double>(p.second);
+			Mat_VarSetStructFieldByName(matvar[8], p.first.c_str(), 0,
+				Mat_VarCreate(p.first.c_str(), MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dim1x1, &v, 0));
+		}
 		for (size_t i = 0; i < nfields; i++) {
 			Mat_VarSetStructFieldByName(elem_list, fieldnames[i], num, matvar[i]);
 		}
@@ -390,6 +377,7 @@ void SolutionModal<FP, T, U>::set_parameter(SolutionOption chk, bool val) {
 	// fmt::print("Modal parameter in boolean.\n");
 	switch (chk) {
 		case SolutionOption::LUMPED_MASS: this->set_mass_lumped(val); break;
+		case SolutionOption::SINGLE_PRECISION_KERNEL: this->set_single_precision(val); break;
 		default: fmt::print("Unsupport boolean parameter in modal analyze.\n");
 	}
 }
@@ -0,0 +1,144 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include "cafea/cafea.h"
+
+namespace cafea {
+/**
+ *  \brief Global dofs of element in order of element matrix.
+ */
+template <class FP, class T, class U>
+std::vector<int> SolutionSpectrum<FP, T, U>::get_dofs(const Element<U> &p_elem) const {
+	const auto &node_list = p_elem.get_node_list();
+	const auto nn = p_elem.get_active_num_of_node();
+	const auto ndof = p_elem.get_dofs_per_node();
+	std::vector<int> res(nn*ndof);
+	for (size_t i = 0; i < nn; i++) {
+		for (size_t j = 0; j < ndof; j++) res[i*ndof+j] = this->dof_table_.get_dof_by_id(node_list[i], j);
+	}
+	return res;
+}
+
+/**
+ *  \brief Solve modes and combine peak displacement.
+ *
+ *  Participation factors use mass normalized modes of modal analysis, and
+ *  influence vectors are translational dofs in global X, Y and Z.
+ */
+template <class FP, class T, class U>
+void SolutionSpectrum<FP, T, U>::solve() {
+	SolutionModal<FP, T, U>::solve();
+	const auto &shp = this->mode_shape_;
+	if (1 > shp.cols()) {
+		fmt::print("None mode for response spectrum.\n");
+		return;
+	}
+	matrix_<U> dir = matrix_<U>::Zero(shp.rows(), 3);
+	const auto &table = this->dof_table_;
+	for (size_t i = 0; i < table.get_num_node(); i++) {
+		for (size_t j = 0; j < 3; j++) {
+			const int k = table.get_dof(i, j);
+			if (0 <= k) dir(k, j) = U(1);
+		}
+	}
+	vecX_<U> freq = this->natural_freq_.col(0);
+	this->spectrum_.load(shp, freq, this->get_global_matrix(true), dir);
+	const auto &meff = this->spectrum_.get_effective_mass();
+	const auto &mtot = this->spectrum_.get_total_mass();
+	for (int j = 0; j < 3; j++) {
+		if (EPS<U>() < mtot(j)) fmt::print("Direction {} effective mass ratio: {:g}\n", j, meff.col(j).sum()/mtot(j));
+	}
+	// Peak displacement, directions combined by SRSS.
+	vecX_<U> disp = this->spectrum_.combine(shp).rowwise().norm();
+	for (auto &it: this->node_group_) {
+		auto &p_node = it.second;
+		if (!p_node.is_activated()) continue;
+		p_node.init_result(SolutionType::SPECTRUM, 0);
+		const auto &tmp = p_node.dof_list();
+		vecX_<U> x = vecX_<U>::Zero(tmp.size());
+		for (int i = 0; i < x.size(); i++) {
+			if (0 <= tmp[i]) x(i) = disp(tmp[i]);
+		}
+		p_node.set_result(SolutionType::SPECTRUM, LoadType::DISP, 0, x);
+	}
+	fmt::print("Response spectrum solve.\n");
+}
+
+/**
+ *  \brief Combine peak member force of pipe elements.
+ *
+ *  Member force of all modes are stacked for every pipe, then all rows are
+ *  combined in one batch before stress evaluation.
+ */
+template <class FP, class T, class U>
+void SolutionSpectrum<FP, T, U>::post_process() {
+	const auto &shp = this->mode_shape_;
+	if (1 > shp.cols() || 0 == this->spectrum_.get_num_mode()) {
+		fmt::print("Solve Response Spectrum Problem is Failed.\n");
+		return;
+	}
+	std::vector<Element<U>*> elem_list;
+	std::vector<matrix_<U>> force_list;
+	Eigen::Index num_row{0};
+	for (auto &it: this->elem_group_) {
+		auto &p_elem = it.second;
+		auto va = this->get_dofs(p_elem);
+		matrix_<U> x = matrix_<U>::Zero(va.size(), shp.cols());
+		for (size_t i = 0; i < va.size(); i++) {
+			if (0 <= va[i]) x.row(i) = shp.row(va[i]);
+		}
+		auto f = p_elem.get_member_force(x);
+		if (12 != f.rows()) continue;
+		elem_list.push_back(&p_elem);
+		force_list.push_back(std::move(f));
+		num_row += 12;
+	}
+	matrix_<U> force(num_row, shp.cols());
+	for (size_t i = 0; i < force_list.size(); i++) force.middleRows(12*i, 12) = force_list[i];
+	force_list.clear();
+	vecX_<U> peak = this->spectrum_.combine(force).rowwise().norm();
+	for (size_t i = 0; i < elem_list.size(); i++) {
+		matrix_<U> f(6, 2);
+		f.col(0) = peak.segment(12*i, 6);
+		f.col(1) = peak.segment(12*i+6, 6);
+		elem_list[i]->post_stress_peak(f);
+	}
+	fmt::print("Peak stress of {} pipe elements.\n", elem_list.size());
+}
+
+/**
+ *  \brief Get peak result of node.
+ */
+template <class FP, class T, class U>
+matrix_<U> SolutionSpectrum<FP, T, U>::get_node_result(int node_id, LoadType res_tp, int res_span) const {
+	assert(0 < node_id);
+	auto got = this->node_group_.find(node_id);
+	matrix_<U> res;
+	if (got != this->node_group_.end()) {
+		res = (got->second).get_result(SolutionType::SPECTRUM, res_tp, 0);
+	} else {
+		res = matrix_<U>::Zero(1, 1);
+	}
+	return res;
+}
+
+/**
+ *  \brief Set solution parameter.
+ */
+template <class FP, class T, class U>
+void SolutionSpectrum<FP, T, U>::set_parameter(SolutionOption chk, init_list_<U> val) {
+	std::vector<U> p(val);
+	switch (chk) {
+		case SolutionOption::SPECTRUM_DAMPING:
+			if (!p.empty()) this->spectrum_.set_damping(p[0]);
+			break;
+		case SolutionOption::SPECTRUM_COMBINATION:
+			if (!p.empty()) this->spectrum_.set_method(static_cast<ModeCombination>(static_cast<int>(p[0])));
+			break;
+		default: SolutionModal<FP, T, U>::set_parameter(chk, val);
+	}
+}
+}  // namespace cafea
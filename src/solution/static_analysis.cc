@@ -21,6 +21,11 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::clear() {
 	if (!this->load_group_.empty()) this->load_group_.clear();
 	if (!this->bc_group_.empty()) this->bc_group_.clear();
 	this->mat_pair_.clear();
+	this->dof_table_.clear();
+	this->conn_.clear();
+	this->dof_part_.clear();
+	this->sol_.resize(0);
+	this->elem_cache_.clear();
 	if (this->solver_) this->solver_.reset(nullptr);
 	fmt::print("This is static clear.\n");
 }
@@ -61,7 +66,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 		for (int i = 0; i < a1; i++, p_node++) {
 			auto got = (*this).node_group_.find(p_node->id_);
 			if (got == (*this).node_group_.end()) {
-				(*this).node_group_[p_node->id_] = f2cpp.cdb2node(p_node);
+				(*this).node_group_.emplace(p_node->id_, f2cpp.cdb2node(p_node));
 				std::vector<int> tmp(p_node->boundary_, p_node->boundary_+7);
 				if (std::any_of(tmp.cbegin(), tmp.cend(), [] (int i) { return i < 0;})) {
 					for (size_t j = 0; j < tmp.size(); j++) {
@@ -101,7 +106,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 		for (int i = 0; i < a2; i++, p_elem++) {
 			auto got = (*this).elem_group_.find(p_elem->id_);
 			if (got == (*this).elem_group_.end()) {
-				(*this).elem_group_[p_elem->id_] = f2cpp.cdb2elem(p_elem);
+				(*this).elem_group_.emplace(p_elem->id_, f2cpp.cdb2elem(p_elem));
 			} else {
 				fmt::print("Duplicated element id:{}\n", p_elem->id_);
 			}
@@ -110,7 +115,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 		for (int i = 0; i < a4; i++, p_real++) {
 			auto got = this->sect_group_.find(p_real->id_);
 			if (got == this->sect_group_.end()) {
-				(*this).sect_group_[p_real->id_] = f2cpp.cdb2sect(p_real);
+				(*this).sect_group_.emplace(p_real->id_, f2cpp.cdb2sect(p_real));
 			} else {
 				fmt::print("Duplicated section id:{}\n", p_real->id_);
 			}
@@ -118,7 +123,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 		for (int i = 0; i < a3; i++, p_matl++) {
 			auto got = this->matl_group_.find(p_matl->id_);
 			if (got == this->matl_group_.end()) {
-				(*this).matl_group_[p_matl->id_] = f2cpp.cdb2matl(p_matl);
+				(*this).matl_group_.emplace(p_matl->id_, f2cpp.cdb2matl(p_matl));
 			} else {
 				fmt::print("Duplicated material id:{}\n", p_matl->id_);
 			}
@@ -141,7 +146,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 			for (int i = 0; i < a1; i++, p_node++) {
 				auto got = this->node_group_.find(p_node->id_);
 				if (got == this->node_group_.end()) {
-					this->node_group_[p_node->id_] = f2cpp.bcy2node(p_node);
+					this->node_group_.emplace(p_node->id_, f2cpp.bcy2node(p_node));
 				} else {
 					fmt::print("Duplicated node id:{}\n", p_node->id_);
 				}
@@ -149,7 +154,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 			for (int i = 0; i < a2; i++, p_elem++) {
 				auto got = this->elem_group_.find(p_elem->id_);
 				if (got == this->elem_group_.end()) {
-					this->elem_group_[p_elem->id_] = f2cpp.bcy2elem(p_elem);
+					this->elem_group_.emplace(p_elem->id_, f2cpp.bcy2elem(p_elem));
 				} else {
 					fmt::print("Duplicated element id:{}\n", p_elem->id_);
 				}
@@ -157,7 +162,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 			for (int i = 0; i < a3; i++, p_matl++) {
 				auto got = this->matl_group_.find(p_matl->id_);
 				if (got == this->matl_group_.end()) {
-					this->matl_group_[p_matl->id_] = f2cpp.bcy2matl(p_matl);
+					this->matl_group_.emplace(p_matl->id_, f2cpp.bcy2matl(p_matl));
 				} else {
 					fmt::print("Duplicated material id:{}\n", p_matl->id_);
 				}
@@ -165,7 +170,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 			for (int i = 0; i < a4; i++, p_sect++) {
 				auto got = this->sect_group_.find(p_sect->id_);
 				if (got == this->sect_group_.end()) {
-					this->sect_group_[p_sect->id_] = f2cpp.bcy2sect(p_sect);
+					this->sect_group_.emplace(p_sect->id_, f2cpp.bcy2sect(p_sect));
 				} else {
 					fmt::print("Duplicated section id:{}\n", p_sect->id_);
 				}
@@ -178,6 +183,7 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::load(const char* fn) {
 			}
 		}
 	}
+	this->init_connectivity();
 	(*this).file_parser_.clean_model();
 }
 
@@ -211,16 +217,16 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::check() {
  */
 template <class FileReader, class Scalar, class ResultScalar>
 void SolutionStatic<FileReader, Scalar, ResultScalar>::analyze() {
-	for (const auto &it: (*this).elem_group_) {
-		const auto &p_elem = it.second;//!< Get element ptr.
-		auto node_list = p_elem.get_node_list();
-		auto et = p_elem.get_element_type();
+	if (this->conn_.get_num_elem() != this->elem_group_.size()) this->init_connectivity();
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		const auto &p_elem = this->elem_group_.value(e);
+		const auto et = p_elem.get_element_type();
+		const int *node = this->conn_.get_node(e);
 		for (int i = 0; i < p_elem.get_active_num_of_node(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) {
-				got->second.activate(true);
-				got->second.dof_init(et);
-			}
+			if (0 > node[i]) continue;
+			auto &p_node = this->node_group_.value(static_cast<size_t>(node[i]));
+			p_node.activate(true);
+			p_node.dof_init(et);
 		}
 	}
 	for (const auto &bc: (*this).bc_group_) {
@@ -229,92 +235,76 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::analyze() {
 			got->second.dof_apply(bc);
 		}
 	}
-	int num{0};
-	for (auto &it: this->node_group_) it.second.dof_accum(&num, DofType::NORMAL);
+	int num = this->init_dof_table();
 
 	fmt::print("Total Dimension:{}\n", num);
 
-	for (const auto &it: this->elem_group_) {
-		const auto &p_elem = it.second;
-		auto node_list = p_elem.get_node_list();
-		auto num = p_elem.get_active_num_of_node();
-		for (int i = 0; i < num; i++) {
-			auto got_i = this->node_group_.find(node_list[i]);
-			if (got_i != this->node_group_.end()) {
-				auto dof_i = got_i->second.dof_list();
-				for (int j = 0; j < num; j++) {
-					auto got_j = this->node_group_.find(node_list[j]);
-						if (got_j != this->node_group_.end()) {
-							auto dof_j = got_j->second.dof_list();
-							for (auto ia: dof_i) {
-								if (ia >= 0) {
-									for (auto ib: dof_j) {
-										if (ib >= 0) this->mat_pair_.append(ia, ib);
-									}
-								}
-							}
-						}
-				}
-			}
-		}
-	}
+	this->init_pattern();
+	this->mat_pair_.set_mass(has_request(this->get_eval_request(), EvalRequest::MASS));
 	this->mat_pair_.unique();
 	fmt::print("Non Zeros: {}\n", this->mat_pair_.get_nnz());
 	fmt::print("Dimension: {}\n", this->mat_pair_.get_dim());
+	this->init_partition(this->load_group_);
 }
 
 /**
  *  \brief Assembly global matrix.
+ *
+ *  Mass is formed and added only when it is requested, such as transient
+ *  analysis.
  */
 template <class FileReader, class Scalar, class ResultScalar>
 void SolutionStatic<FileReader, Scalar, ResultScalar>::assembly() {
 	bool lumped{false};
 	if (this->mass_type_ == MassType::LUMPED) lumped = true;
+	const auto req = this->get_eval_request();
+	const bool with_mass = this->mat_pair_.has_mass() && has_request(req, EvalRequest::MASS);
 
-	for (auto &it: this->elem_group_) {
-		auto &p_elem = it.second;
+	this->open_element_cache();
+	std::vector<const int*> node_dofs;
+	typename SolutionStatic<FileReader, Scalar, ResultScalar>::node_view_ pt;
+	for (size_t e = 0; e < this->elem_group_.size(); e++) {
+		auto &p_elem = this->elem_group_.value(e);
 		if (lumped) p_elem.set_lumped_mass(lumped);
-		auto node_list = p_elem.get_node_list();
-		auto mt = p_elem.get_material_id();
-		auto st = p_elem.get_section_id();
-		auto got_mt = this->matl_group_.find(mt);
-		auto got_st = this->sect_group_.find(st);
-		assert(got_mt != this->matl_group_.end());
-		assert(got_st != this->sect_group_.end());
-		Node<Scalar, ResultScalar> pt[node_list.size()];
-		for (size_t i = 0; i < node_list.size(); i++) {
-			auto got = this->node_group_.find(node_list[i]);
-			if (got != this->node_group_.end()) pt[i] = got->second;
-		}
-		p_elem.template form_matrix<Scalar>(pt, &(got_mt->second), &(got_st->second));
-		auto p_stif = p_elem.get_stif();
-		auto p_mass = p_elem.get_mass();
-		auto p_tran = p_elem.get_tran();
-		auto p_rhs = p_elem.get_rhs();
-		p_stif = p_tran.transpose()*p_stif*p_tran;
-		p_mass = p_tran.transpose()*p_mass*p_tran;
-		p_rhs = p_tran.transpose()*p_rhs;
+		p_elem.set_eval_request(req);
+		p_elem.set_single_precision(this->single_kernel_);
+		assert(0 <= this->conn_.get_material(e));
+		assert(0 <= this->conn_.get_section(e));
+		const auto &p_matl = this->matl_group_.value(static_cast<size_t>(this->conn_.get_material(e)));
+		const auto &p_sect = this->sect_group_.value(static_cast<size_t>(this->conn_.get_section(e)));
+		this->get_node_view(e, pt);
+		this->form_element(p_elem, pt.data(), &p_matl, &p_sect);
+		this->get_node_dofs(e, node_dofs);
 
 		auto nn = p_elem.get_active_num_of_node();
 		auto ndof = p_elem.get_dofs_per_node();
-		for (auto ia = 0; ia < nn; ia++) {
-			auto va = pt[ia].dof_list();
-			for (auto ja = 0; ja < ndof; ja++) {
-				p_elem.set_element_dofs(va[ja]);
-				if (va[ja] < 0) continue;
-				auto row_ = ia*ndof+ja;
-				this->mat_pair_.add_rhs_data(va[ja], p_rhs(row_));
-				for (auto ib = 0; ib < nn; ib++) {
-					auto vb = pt[ib].dof_list();
-					for (auto jb = 0; jb < ndof; jb++) {
-						if (vb[jb] < 0) continue;
-						auto col_ = ib*ndof+jb;
-						this->mat_pair_.add_matrix_data(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+		p_elem.clear_element_dofs();
+		this->visit_element_matrix(p_elem, [&] (const auto &p_stif, const auto &p_mass, const auto &p_rhs) {
+			for (size_t ia = 0; ia < nn; ia++) {
+				const int *va = node_dofs[ia];
+				for (size_t ja = 0; ja < ndof; ja++) {
+					p_elem.set_element_dofs(nullptr == va ? -1: va[ja]);
+					if (nullptr == va || va[ja] < 0) continue;
+					auto row_ = ia*ndof+ja;
+					this->mat_pair_.add_rhs_data(va[ja], p_rhs(row_));
+					for (size_t ib = 0; ib < nn; ib++) {
+						const int *vb = node_dofs[ib];
+						if (nullptr == vb) continue;
+						for (size_t jb = 0; jb < ndof; jb++) {
+							if (vb[jb] < 0) continue;
+							auto col_ = ib*ndof+jb;
+							if (with_mass) {
+								this->mat_pair_.add_matrix_data(va[ja], vb[jb], p_stif(row_, col_), p_mass(row_, col_));
+							} else {
+								this->mat_pair_.add_matrix_data_K(va[ja], vb[jb], p_stif(row_, col_));
+							}
+						}
 					}
 				}
 			}
-		}
+		});
 	}
+	this->close_element_cache();
 }
 
 /**
@@ -322,20 +312,32 @@ void SolutionStatic<FileReader, Scalar, ResultScalar>::assembly() {
  */
 template <class FileReader, class T, class U>
 void SolutionStatic<FileReader, T, U>::solve() {
-	this->solver_->load(this->mat_pair_.get_stif_ptr(), this->mat_pair_.get_coord_ptr(),
-		this->mat_pair_.get_nnz(), this->mat_pair_.get_dim());
-
-	bool flag = this->solver_->solve(this->mat_pair_.get_rhs_ptr(), this->mat_pair_.get_dim());
+	bool flag{false};
+	auto dim = this->mat_pair_.get_dim();
+	if (!this->dof_part_.has_fixed() || this->load_group_.empty()) {
+		this->solver_->load(this->mat_pair_.get_stif_ptr(), this->mat_pair_.get_coord_ptr(),
+			this->mat_pair_.get_nnz(), dim);
+		flag = this->solver_->solve(this->mat_pair_.get_rhs_ptr(), dim);
+		if (flag) this->sol_ = this->solver_->get_X();
+	} else {
+		// Prescribed displacement moves to RHS, K_ff keeps positive definite.
+		Eigen::SparseMatrix<U> mat_K = this->get_global_matrix();
+		vecX_<U> rhs = Eigen::Map<const vecX_<U>>(this->mat_pair_.get_rhs_ptr(), dim);
+		vecX_<U> u_p = this->template get_prescribed_value<U>(this->load_group_[0]);
+		this->solver_->load(this->dof_part_.get_ff(mat_K));
+		flag = this->solver_->solve(this->dof_part_.get_rhs(rhs, this->dof_part_.get_fp(mat_K), u_p));
+		if (flag) this->sol_ = this->dof_part_.expand(this->solver_->get_X(), u_p);
+	}
 	if (!flag) {
 		fmt::print("Solve Failed.\n");
 	} else {
 		fmt::print("Solve Success.\n");
-		auto sol = this->solver_->get_X();
+		const auto &sol = this->sol_;
 		for (auto &it: this->node_group_) {
 			auto &p_node = it.second;
 			p_node.init_result(SolutionType::STATIC, 0);
 			if (p_node.is_activated()) {
-				auto tmp = p_node.dof_list();
+				const auto &tmp = p_node.dof_list();
 				vecX_<U> x = vecX_<U>::Zero(tmp.size());
 				for (int i = 0; i < x.size(); i++) { x(i) = tmp[i] < 0 ? U(0): sol(tmp[i]);}
 				p_node.set_result(SolutionType::STATIC, LoadType::DISP, 0, x);
@@ -346,6 +348,8 @@ void SolutionStatic<FileReader, T, U>::solve() {
 
 /**
  *  \brief Post-process.
+ *
+ *  Elements are evaluated in parallel, each with its own displacement.
  */
 template <class FileReader, class T, class U>
 void SolutionStatic<FileReader, T, U>::post_process() {
@@ -353,15 +357,19 @@ void SolutionStatic<FileReader, T, U>::post_process() {
 		fmt::print("Solve Static Problem is Failed.\n");
 		return;
 	}
-	auto sol = this->solver_->get_X();
+	const auto &sol = this->sol_;
 
-	for (auto &it: this->elem_group_) {
-		auto &p_elem = it.second;
-		auto va = p_elem.get_element_dofs();
+	std::vector<Element<U>*> elem_list;
+	elem_list.reserve(this->elem_group_.size());
+	for (auto &it: this->elem_group_) elem_list.push_back(&it.second);
+	NodalScatter::for_each(elem_list.size(), [&] (size_t k) {
+		auto &p_elem = *elem_list[k];
+		p_elem.set_result_request(this->result_req_);
+		const auto &va = p_elem.get_element_dofs();
 		vecX_<U> x = vecX_<U>::Zero(va.size());
 		for (int i = 0; i < x.size(); i++) { x(i) = va[i]<0 ? U(0): sol(va[i]);}
 		p_elem.post_stress(x);
-	}
+	});
 }
 
 /**
@@ -427,9 +435,10 @@ void SolutionStatic<FileReader, Scalar, U>::write2mat(const char* fname, bool is
 		// element stiffness matrix.
 		matvar[5] = Mat_VarCreate(fieldnames[5], MAT_C_DOUBLE, MAT_T_DOUBLE, 2,
 			sz.data(), const_cast<U*>(p_elem.get_stif_ptr()), MAT_F_DONT_COPY_DATA);
-		// element mass matrix.
+		// element mass matrix, empty when it is not requested.
+		auto sm = nullptr == p_elem.get_mass_ptr() ? std::array<size_t, 2>{0, 0}: sz;
 		matvar[6] = Mat_VarCreate(fieldnames[6], MAT_C_DOUBLE, MAT_T_DOUBLE, 2,
-			sz.data(), const_cast<U*>(p_elem.get_mass_ptr()), MAT_F_DONT_COPY_DATA);
+			sm.data(), const_cast<U*>(p_elem.get_mass_ptr()), MAT_F_DONT_COPY_DATA);
 		// element transpose matrix.
 		matvar[7] = Mat_VarCreate(fieldnames[7], MAT_C_DOUBLE, MAT_T_DOUBLE, 2,
 			sz.data(), const_cast<U*>(p_elem.get_tran_ptr()), MAT_F_DONT_COPY_DATA);
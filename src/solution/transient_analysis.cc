@@ -0,0 +1,244 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cstdint>
+#include <fstream>
+#include <numeric>
+
+#include "cafea/cafea.h"
+
+namespace cafea {
+/**
+ *  \brief Initilize variables.
+ */
+template <class FileReader, class T, class U>
+void SolutionTransient<FileReader, T, U>::init() {
+	this->clear();
+	std::unique_ptr<TimeIntegrator<U>> p(new TimeIntegrator<U>);
+	this->solver_ = std::move(p);
+	fmt::print("This is transient init.\n");
+}
+/**
+ *  \brief Clear member variables.
+ */
+template <class FileReader, class T, class U>
+void SolutionTransient<FileReader, T, U>::clear() {
+	SolutionStatic<FileReader, T, U>::clear();
+	if (this->solver_) this->solver_.reset(nullptr);
+	this->load_time_.clear();
+	this->load_force_.clear();
+	this->load_disp_.clear();
+	fmt::print("This is transient clear.\n");
+}
+
+/**
+ *  \brief Interpolate load linearly between load sets.
+ *  \param[in] t time.
+ *  \param[out] f global force.
+ *  \param[out] u_p prescribed displacement.
+ *
+ *  Load keeps the value of the first and last load set out of range.
+ */
+template <class FileReader, class T, class U>
+void SolutionTransient<FileReader, T, U>::get_load(U t, vecX_<U> &f, vecX_<U> &u_p) const {
+	const auto &tt = this->load_time_;
+	auto p = std::upper_bound(tt.begin(), tt.end(), t);
+	if (p == tt.begin()) {
+		f = this->load_force_.front();
+		u_p = this->load_disp_.front();
+	} else if (p == tt.end()) {
+		f = this->load_force_.back();
+		u_p = this->load_disp_.back();
+	} else {
+		auto k = std::distance(tt.begin(), p);
+		U s = (t-tt[k-1])/(tt[k]-tt[k-1]);
+		f = (U(1)-s)*this->load_force_[k-1]+s*this->load_force_[k];
+		u_p = (U(1)-s)*this->load_disp_[k-1]+s*this->load_disp_[k];
+	}
+}
+
+/**
+ *  \brief Solve by implicit time integration.
+ *
+ *  Effective stiffness is factorized once for constant time step. Results
+ *  of every stride steps are appended to binary file, which begins with
+ *  int64 dimension and follows records of [t, u, v, a] in ResultScalar.
+ *  Prescribed dofs are eliminated with stiffness coupling \f$ K_{fp}u_p(t) \f$.
+ */
+template <class FileReader, class T, class U>
+void SolutionTransient<FileReader, T, U>::solve() {
+	if (!this->solver_) {
+		fmt::print("Transient solver is not initialized.\n");
+		return;
+	}
+	if (1 > this->num_step_ || U(0) >= this->dt_) {
+		fmt::print("None time step in transient analysis.\n");
+		return;
+	}
+	auto dim = this->mat_pair_.get_dim();
+	const auto &part = this->dof_part_;
+	Eigen::SparseMatrix<U> mat_K = this->get_global_matrix(), mat_M = this->get_global_matrix(true);
+	Eigen::SparseMatrix<U> mat_K_fp = part.get_fp(mat_K);
+	this->solver_->load(part.get_ff(mat_K), part.get_ff(mat_M), this->rayleigh_[0], this->rayleigh_[1]);
+	this->solver_->set_hht_alpha(this->alpha_);
+
+	// Load table sorted by time, element rhs is constant.
+	vecX_<U> f_const = Eigen::Map<const vecX_<U>>(this->mat_pair_.get_rhs_ptr(), dim);
+	std::vector<size_t> order(this->load_group_.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [this] (size_t a, size_t b) {
+		return this->load_group_[a].get_value() < this->load_group_[b].get_value();});
+	this->load_time_.clear();
+	this->load_force_.clear();
+	this->load_disp_.clear();
+	for (auto i: order) {
+		auto &p_load = this->load_group_[i];
+		if (LoadDomain::TIME != p_load.get_load_domain()) continue;
+		vecX_<U> f = f_const;
+		this->add_force(p_load, f);
+		this->load_time_.push_back(U(p_load.get_value()));
+		this->load_force_.push_back(std::move(f));
+		this->load_disp_.push_back(this->template get_prescribed_value<U>(p_load));
+	}
+	if (this->load_time_.empty()) {
+		this->load_time_.push_back(U(0));
+		this->load_force_.push_back(f_const);
+		this->load_disp_.push_back(vecX_<U>::Zero(part.get_num_fixed()));
+	}
+
+	std::ofstream fp(this->output_, std::ios::binary | std::ios::trunc);
+	if (!fp.is_open()) {
+		fmt::print("Cannot open result file: {}\n", this->output_);
+		return;
+	}
+	const std::int64_t dim_out = static_cast<std::int64_t>(dim);
+	fp.write(reinterpret_cast<const char*>(&dim_out), sizeof(dim_out));
+	const vecX_<U> zero_p = vecX_<U>::Zero(part.get_num_fixed());
+	vecX_<U> f, u_p;
+	size_t num_record{0};
+	auto write_step = [&] (U t) {
+		vecX_<U> u = part.expand(this->solver_->get_disp(), u_p);
+		vecX_<U> v = part.expand(this->solver_->get_vel(), zero_p);
+		vecX_<U> a = part.expand(this->solver_->get_accel(), zero_p);
+		fp.write(reinterpret_cast<const char*>(&t), sizeof(U));
+		fp.write(reinterpret_cast<const char*>(u.data()), sizeof(U)*dim);
+		fp.write(reinterpret_cast<const char*>(v.data()), sizeof(U)*dim);
+		fp.write(reinterpret_cast<const char*>(a.data()), sizeof(U)*dim);
+		num_record++;
+	};
+
+	U t0 = this->load_time_.front();
+	this->get_load(t0, f, u_p);
+	vecX_<U> zero_f = vecX_<U>::Zero(part.get_num_free());
+	this->solver_->init(zero_f, zero_f, part.get_rhs(f, mat_K_fp, u_p), t0);
+	write_step(t0);
+	bool flag{true};
+	for (int i = 1; i <= this->num_step_; i++) {
+		U t = t0+this->dt_*U(i);
+		this->get_load(t, f, u_p);
+		if (!this->solver_->step(this->dt_, part.get_rhs(f, mat_K_fp, u_p))) {
+			flag = false;
+			break;
+		}
+		if (0 == i%this->stride_ || this->num_step_ == i) write_step(t);
+	}
+	fp.close();
+	fmt::print("Time steps: {}\tFactorization: {}\tRecords: {}\n", this->solver_->get_num_step(),
+		this->solver_->get_num_factorization(), num_record);
+	if (!flag) {
+		fmt::print("Solve Failed.\n");
+		return;
+	}
+	this->sol_ = part.expand(this->solver_->get_disp(), u_p);
+	vecX_<U> vel = part.expand(this->solver_->get_vel(), zero_p);
+	vecX_<U> accel = part.expand(this->solver_->get_accel(), zero_p);
+	for (auto &it: this->node_group_) {
+		auto &p_node = it.second;
+		if (!p_node.is_activated()) continue;
+		p_node.init_result(SolutionType::TRANSIENT, 0);
+		const auto &tmp = p_node.dof_list();
+		vecX_<U> x = vecX_<U>::Zero(tmp.size()), y = x, z = x;
+		for (int i = 0; i < x.size(); i++) {
+			if (0 > tmp[i]) continue;
+			x(i) = this->sol_(tmp[i]);
+			y(i) = vel(tmp[i]);
+			z(i) = accel(tmp[i]);
+		}
+		p_node.set_result(SolutionType::TRANSIENT, LoadType::DISP, 0, x);
+		p_node.set_result(SolutionType::TRANSIENT, LoadType::VEL, 0, y);
+		p_node.set_result(SolutionType::TRANSIENT, LoadType::ACCEL, 0, z);
+	}
+	fmt::print("Transient solve.\n");
+}
+
+/**
+ *  \brief Post-process at the last step.
+ */
+template <class FileReader, class T, class U>
+void SolutionTransient<FileReader, T, U>::post_process() {
+	if (1 > this->sol_.size()) {
+		fmt::print("Solve Transient Problem is Failed.\n");
+		return;
+	}
+	for (auto &it: this->elem_group_) {
+		auto &p_elem = it.second;
+		const auto &va = p_elem.get_element_dofs();
+		vecX_<U> x = vecX_<U>::Zero(va.size());
+		for (int i = 0; i < x.size(); i++) { x(i) = va[i] < 0 ? U(0): this->sol_(va[i]);}
+		p_elem.post_stress(x);
+	}
+}
+
+/**
+ *  \brief Get node result at the last step.
+ */
+template <class FP, class T, class U>
+matrix_<U> SolutionTransient<FP, T, U>::get_node_result(int node_id, LoadType res_tp, int res_span) const {
+	assert(0 < node_id);
+	auto got = this->node_group_.find(node_id);
+	matrix_<U> res;
+	if (got != this->node_group_.end()) {
+		res = (got->second).get_result(SolutionType::TRANSIENT, res_tp, 0);
+	} else {
+		res = matrix_<U>::Zero(1, 1);
+	}
+	return res;
+}
+
+/**
+ *  \brief Set solution parameter.
+ */
+template <class FP, class T, class U>
+void SolutionTransient<FP, T, U>::set_parameter(SolutionOption chk, init_list_<U> val) {
+	std::vector<U> p(val);
+	if (p.empty()) return;
+	switch (chk) {
+		case SolutionOption::TRANSIENT_TIME_STEP:
+			this->dt_ = p[0];
+			if (1 < p.size()) this->num_step_ = static_cast<int>(p[1]);
+			break;
+		case SolutionOption::TRANSIENT_HHT_ALPHA: this->alpha_ = p[0]; break;
+		case SolutionOption::TRANSIENT_OUTPUT_STRIDE: this->stride_ = std::max(1, static_cast<int>(p[0])); break;
+		case SolutionOption::RAYLEIGH_DAMPING:
+			this->rayleigh_[0] = p[0];
+			if (1 < p.size()) this->rayleigh_[1] = p[1];
+			break;
+		default: fmt::print("Unsupport numeric parameter in transient analyze.\n");
+	}
+}
+
+/**
+ * \brief Set solution parameter.
+ */
+template <class FP, class T, class U>
+void SolutionTransient<FP, T, U>::set_parameter(SolutionOption chk, bool val) {
+	switch (chk) {
+		case SolutionOption::LUMPED_MASS: this->set_mass_lumped(val); break;
+		case SolutionOption::SINGLE_PRECISION_KERNEL: this->set_single_precision(val); break;
+		default: fmt::print("Unsupport boolean parameter in transient analyze.\n");
+	}
+}
+}  // namespace cafea
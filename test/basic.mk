@@ -133,7 +133,7 @@ b02: ../fmt/fmt/format.o ../src/base/dof_handler.o ../src/element/element_attr.o
 	./test_$@
 
 b03: ../fmt/fmt/format.o $(addprefix ../src/base/, $(addsuffix .o, dof_handler node load material section))\
-../src/core/coord_tran.o $(addprefix ../src/element/, $(addsuffix .o, element_attr element pipe additional))\
+../src/core/coord_tran.o ../src/core/block_tran.o $(addprefix ../src/element/, $(addsuffix .o, element_attr element pipe additional element_cache shell solid))\
 ./basic/b03.o
 	@echo -e $(COMMENT)
 	@echo -e $(BLANK)$(RED)"[Basic] Element test 01."$(COLOR_OFF)
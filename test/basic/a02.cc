@@ -50,7 +50,7 @@ TEST_CASE("add load cell 01", "[LoadSet]") {
     LoadSet<float> pa(random_value(1, 100), LoadDomain::FREQ, 2.25f);
     for (int num: {10, 100, 1000, 10000, 100000, 1000000,}) {
         for (int i = 0; i < num; i++) pa.add_load(gen_random_cell<float>());
-        REQUIRE(pa.get_count() == num);
+        REQUIRE(pa.get_count() == static_cast<size_t>(num));
         int total = num;
         for (auto x: {LoadType::FORCE, LoadType::DISP, LoadType::VEL, LoadType::PRES,
             LoadType::ACCEL, LoadType::STRESS, LoadType::UNKNOWN,}) {
@@ -79,7 +79,7 @@ TEST_CASE("add load cell 02", "[LoadSet]") {
             auto y = pa.add_load(random_value(1, num*2), gen_load_type(), gen_dof_label(), random_value<float>(-2.f*num, 2.f*num));
             REQUIRE(y == 0);
         }
-        REQUIRE(pa.get_count() == num);
+        REQUIRE(pa.get_count() == static_cast<size_t>(num));
         int total = num;
         for (auto x: {LoadType::FORCE, LoadType::DISP, LoadType::VEL, LoadType::PRES,
             LoadType::ACCEL, LoadType::STRESS, LoadType::UNKNOWN,}) {
@@ -113,7 +113,7 @@ TEST_CASE("add load cell 03", "[LoadSet]") {
                 REQUIRE(y == 0);
             }
         }
-        REQUIRE(pa.get_count() == num);
+        REQUIRE(pa.get_count() == static_cast<size_t>(num));
         int total = num;
         for (auto x: {LoadType::FORCE, LoadType::DISP, LoadType::VEL, LoadType::PRES,
             LoadType::ACCEL, LoadType::STRESS, LoadType::UNKNOWN,}) {
@@ -23,7 +23,7 @@ TEST_CASE("set dof number", "[dof handler]") {
     for (auto x: {1, 2, 3, 4, 5, 6,}) {
         pp.clear();
         pp.set_num_dofs(x);
-        REQUIRE(x == pp.get_num_dofs());
+        REQUIRE(static_cast<size_t>(x) == pp.get_num_dofs());
     }
 }
 
@@ -0,0 +1,109 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/krylov_mor.hpp"
+
+using namespace cafea;
+
+namespace {
+// Fixed-free spring mass chain.
+void spring_mass_chain(int n, Eigen::SparseMatrix<double> &K, Eigen::SparseMatrix<double> &M) {
+    std::vector<Eigen::Triplet<double>> kk, mm;
+    const double k{1.e6}, m{1.e-1};
+    for (int i = 0; i < n; i++) {
+        kk.emplace_back(i, i, i+1 < n ? 2.0*k: k);
+        if (i+1 < n) {
+            kk.emplace_back(i, i+1, -k);
+            kk.emplace_back(i+1, i, -k);
+        }
+        mm.emplace_back(i, i, m);
+    }
+    K.resize(n, n);
+    M.resize(n, n);
+    K.setFromTriplets(kk.begin(), kk.end());
+    M.setFromTriplets(mm.begin(), mm.end());
+}
+
+vecX_<COMPLEX8> direct_solve(const Eigen::SparseMatrix<double> &K, const Eigen::SparseMatrix<double> &M,
+    double damp, double freq, const vecX_<COMPLEX8> &f) {
+    const double omega = 2.0*PI<double>()*freq;
+    Eigen::SparseMatrix<COMPLEX8> A = K.cast<COMPLEX8>()*COMPLEX8(1.0, damp)
+        - COMPLEX8(omega*omega)*M.cast<COMPLEX8>();
+    Eigen::SparseLU<Eigen::SparseMatrix<COMPLEX8>> solver(A);
+    return solver.solve(f);
+}
+}
+
+TEST_CASE("init", "[KrylovReducer]") {
+    KrylovReducer<double> mor;
+    REQUIRE(0 == mor.get_dim());
+    REQUIRE(0 == mor.get_full_dim());
+    REQUIRE(mor.get_expansion_points().empty());
+}
+
+TEST_CASE("single point", "[KrylovReducer]") {
+    const int n{200};
+    Eigen::SparseMatrix<double> K, M;
+    spring_mass_chain(n, K, M);
+    cmatrix_<double> f = cmatrix_<double>::Zero(n, 1);
+    f(n-1, 0) = 1.0;
+
+    KrylovReducer<double> mor;
+    mor.load(K, M, 0.02);
+    mor.set_rhs(f);
+    REQUIRE(mor.expand(100.0, 6));
+    REQUIRE(6 == mor.get_dim());
+    REQUIRE(n == mor.get_full_dim());
+    // Basis is orthonormal.
+    cmatrix_<double> V = mor.get_basis();
+    cmatrix_<double> I = V.adjoint()*V;
+    REQUIRE((I-cmatrix_<double>::Identity(6, 6)).norm() == Approx(0.0).margin(1.e-10));
+    // Exact at expansion point.
+    vecX_<COMPLEX8> x0 = direct_solve(K, M, 0.02, 100.0, f.col(0));
+    vecX_<COMPLEX8> x1 = mor.solve(100.0, 0);
+    REQUIRE((x1-x0).norm()/x0.norm() == Approx(0.0).margin(1.e-8));
+    REQUIRE(mor.estimate(100.0) == Approx(0.0).margin(1.e-8));
+}
+
+TEST_CASE("adaptive band", "[KrylovReducer]") {
+    const int n{300};
+    Eigen::SparseMatrix<double> K, M;
+    spring_mass_chain(n, K, M);
+    cmatrix_<double> f = cmatrix_<double>::Zero(n, 2);
+    f(n-1, 0) = 1.0;
+    f(n/2, 1) = COMPLEX8(0.0, 2.0);
+
+    KrylovReducer<double> mor;
+    mor.load(K, M, 0.01);
+    mor.set_rhs(f);
+    const double lb{1.0}, ub{80.0}, tol{1.e-8};
+    REQUIRE(mor.reduce(lb, ub, tol, 4, 12, 100));
+    REQUIRE(1 < mor.get_expansion_points().size());
+    REQUIRE(mor.get_dim() < static_cast<size_t>(n/2));
+    for (auto freq: {3.3, 17.7, 42.1, 63.5, 79.9}) {
+        cmatrix_<double> x = mor.solve(freq);
+        for (int j = 0; j < 2; j++) {
+            vecX_<COMPLEX8> x0 = direct_solve(K, M, 0.01, freq, f.col(j));
+            REQUIRE((x.col(j)-x0).norm()/x0.norm() == Approx(0.0).margin(1.e-5));
+        }
+    }
+}
+
+TEST_CASE("dependent load cases", "[KrylovReducer]") {
+    const int n{100};
+    Eigen::SparseMatrix<double> K, M;
+    spring_mass_chain(n, K, M);
+    cmatrix_<double> f = cmatrix_<double>::Zero(n, 3);
+    f(n-1, 0) = 1.0;
+    f.col(1) = 2.5*f.col(0);
+    f.col(2) = COMPLEX8(0.0, -1.0)*f.col(0);
+
+    KrylovReducer<double> mor;
+    mor.load(K, M);
+    mor.set_rhs(f);
+    REQUIRE(mor.expand(10.0, 5));
+    // Single input block shared by all load cases.
+    REQUIRE(5 == mor.get_dim());
+}
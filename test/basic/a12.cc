@@ -0,0 +1,122 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/dof_partition.hpp"
+
+using namespace cafea;
+
+namespace {
+template <class T>
+Eigen::SparseMatrix<T> laplace_1d(int n, T diag, T off) {
+    std::vector<Eigen::Triplet<T>> tri_list;
+    for (int i = 0; i < n; i++) {
+        tri_list.emplace_back(i, i, diag);
+        if (i+1 < n) {
+            tri_list.emplace_back(i, i+1, off);
+            tri_list.emplace_back(i+1, i, off);
+        }
+    }
+    Eigen::SparseMatrix<T> A(n, n);
+    A.setFromTriplets(tri_list.begin(), tri_list.end());
+    return A;
+}
+
+// Reference: replace prescribed rows by identity.
+template <class T>
+vecX_<T> solve_row_replace(const Eigen::SparseMatrix<T> &A, vecX_<T> b,
+    const std::vector<size_t> &fixed, const vecX_<T> &u_p) {
+    matrix_<T> D = A;
+    for (size_t k = 0; k < fixed.size(); k++) {
+        D.row(fixed[k]).setZero();
+        D(fixed[k], fixed[k]) = T(1);
+        b(fixed[k]) = u_p(k);
+    }
+    return D.partialPivLu().solve(b);
+}
+}
+
+TEST_CASE("init", "[DofPartition]") {
+    DofPartition part;
+    REQUIRE(0 == part.get_dim());
+    part.init(10, {7, 2, 2, 9});
+    REQUIRE(10 == part.get_dim());
+    REQUIRE(3 == part.get_num_fixed());
+    REQUIRE(7 == part.get_num_free());
+    REQUIRE(part.has_fixed());
+    std::vector<size_t> fixed{2, 7, 9};
+    REQUIRE(fixed == part.get_fixed_list());
+    for (size_t i = 0; i < fixed.size(); i++) {
+        REQUIRE(static_cast<int>(i) == part.get_fixed_index(fixed[i]));
+        REQUIRE(-1 == part.get_free_index(fixed[i]));
+    }
+    int k{0};
+    for (auto i: part.get_free_list()) {
+        REQUIRE(k++ == part.get_free_index(i));
+        REQUIRE(-1 == part.get_fixed_index(i));
+    }
+    part.init(4, {});
+    REQUIRE(!part.has_fixed());
+    REQUIRE(4 == part.get_num_free());
+}
+
+TEST_CASE("block pattern", "[DofPartition]") {
+    const int n{20};
+    auto A = laplace_1d<double>(n, 2.0, -1.0);
+    DofPartition part;
+    part.init(n, {0, 10, 19});
+    auto A_ff = part.get_ff(A);
+    auto A_fp = part.get_fp(A);
+    REQUIRE(17 == A_ff.rows());
+    REQUIRE(17 == A_ff.cols());
+    REQUIRE(17 == A_fp.rows());
+    REQUIRE(3 == A_fp.cols());
+    // Free segments 1-9 and 11-18 with 8 and 7 couplings.
+    REQUIRE(17+2*(8+7) == A_ff.nonZeros());
+    // Neighbours of dof 0, 10, 19.
+    REQUIRE(4 == A_fp.nonZeros());
+    matrix_<double> D = A, D_ff = A_ff;
+    const auto &free_list = part.get_free_list();
+    for (size_t i = 0; i < free_list.size(); i++) {
+        for (size_t j = 0; j < free_list.size(); j++) {
+            REQUIRE(D_ff(i, j) == D(free_list[i], free_list[j]));
+        }
+    }
+}
+
+TEST_CASE("real elimination", "[DofPartition]") {
+    const int n{50};
+    auto A = laplace_1d<double>(n, 2.0, -1.0);
+    vecX_<double> b = vecX_<double>::Constant(n, 1.e-2);
+    std::vector<size_t> fixed{0, 25, 49};
+    vecX_<double> u_p(3);
+    u_p << 0.0, 1.5, -0.5;
+    DofPartition part;
+    part.init(n, fixed);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(part.get_ff(A));
+    REQUIRE(solver.info() == Eigen::ComputationInfo::Success);
+    vecX_<double> x_f = solver.solve(part.get_rhs(b, part.get_fp(A), u_p));
+    vecX_<double> x = part.expand(x_f, u_p);
+    vecX_<double> x0 = solve_row_replace(A, b, fixed, u_p);
+    REQUIRE((x-x0).norm()/x0.norm() == Approx(0.0).margin(1.e-12));
+    for (size_t k = 0; k < fixed.size(); k++) REQUIRE(x(fixed[k]) == u_p(k));
+}
+
+TEST_CASE("complex elimination", "[DofPartition]") {
+    const int n{40};
+    using C = COMPLEX<double>;
+    Eigen::SparseMatrix<C> A = laplace_1d<C>(n, C(2.0, 0.04), C(-1.0, -0.02))
+        - C(0.3)*laplace_1d<C>(n, C(1.0), C(0.0));
+    vecX_<C> b = vecX_<C>::Zero(n);
+    b(5) = C(0.0, 1.0);
+    std::vector<size_t> fixed{0, 1, 39};
+    vecX_<C> u_p(3);
+    u_p << C(1.0, 0.0), C(0.0, 0.5), C(0.0);
+    DofPartition part;
+    part.init(n, fixed);
+    Eigen::SparseLU<Eigen::SparseMatrix<C>> solver(part.get_ff(A));
+    vecX_<C> x = part.expand<C>(solver.solve(part.get_rhs(b, part.get_fp(A), u_p)), u_p);
+    vecX_<C> x0 = solve_row_replace(A, b, fixed, u_p);
+    REQUIRE((x-x0).norm()/x0.norm() == Approx(0.0).margin(1.e-12));
+}
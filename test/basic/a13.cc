@@ -0,0 +1,92 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "cafea/base/time_integrator.hpp"
+
+using namespace cafea;
+
+namespace {
+Eigen::SparseMatrix<double> diag_matrix(int n, double val) {
+    Eigen::SparseMatrix<double> A(n, n);
+    std::vector<Eigen::Triplet<double>> tri_list;
+    for (int i = 0; i < n; i++) tri_list.emplace_back(i, i, val);
+    A.setFromTriplets(tri_list.begin(), tri_list.end());
+    return A;
+}
+}
+
+TEST_CASE("init", "[TimeIntegrator]") {
+    TimeIntegrator<double> p;
+    REQUIRE(0 == p.get_num_step());
+    REQUIRE(0 == p.get_num_factorization());
+    auto [alpha, beta, gamma] = p.get_parameter();
+    REQUIRE(0.0 == alpha);
+    REQUIRE(0.25 == beta);
+    REQUIRE(0.5 == gamma);
+    p.set_hht_alpha(-1.0);
+    std::tie(alpha, beta, gamma) = p.get_parameter();
+    REQUIRE(alpha == Approx(-1.0/3.0));
+    REQUIRE(beta == Approx(4.0/9.0));
+    REQUIRE(gamma == Approx(5.0/6.0));
+}
+
+TEST_CASE("free vibration", "[TimeIntegrator]") {
+    const double k{4.e4}, m{1.0}, omega = std::sqrt(k/m), period = 2.0*PI<double>()/omega;
+    TimeIntegrator<double> p;
+    p.load(diag_matrix(1, k), diag_matrix(1, m));
+    vecX_<double> u0 = vecX_<double>::Constant(1, 1.e-2), zero = vecX_<double>::Zero(1);
+    REQUIRE(p.init(u0, zero, zero));
+    REQUIRE(p.get_accel()(0) == Approx(-k/m*1.e-2));
+    const int num{400};
+    const double dt = period/num;
+    for (int i = 0; i < num; i++) REQUIRE(p.step(dt, zero));
+    REQUIRE(num == p.get_num_step());
+    REQUIRE(1 == p.get_num_factorization());
+    REQUIRE(p.get_time() == Approx(period));
+    REQUIRE(p.get_disp()(0) == Approx(1.e-2).epsilon(1.e-3));
+    // Average acceleration conserves energy.
+    double energy = 0.5*k*p.get_disp()(0)*p.get_disp()(0)+0.5*m*p.get_vel()(0)*p.get_vel()(0);
+    REQUIRE(energy == Approx(0.5*k*1.e-4).epsilon(1.e-10));
+}
+
+TEST_CASE("factorize once per time step", "[TimeIntegrator]") {
+    const int n{5};
+    TimeIntegrator<double> p;
+    p.load(diag_matrix(n, 1.e3), diag_matrix(n, 1.0), 20.0, 1.e-4);
+    vecX_<double> zero = vecX_<double>::Zero(n), f = vecX_<double>::Ones(n);
+    p.init(zero, zero, zero);
+    for (int i = 0; i < 1000; i++) p.step(1.e-3, f);
+    REQUIRE(1 == p.get_num_factorization());
+    for (int i = 0; i < 1000; i++) p.step(2.e-3, f);
+    REQUIRE(2 == p.get_num_factorization());
+    p.set_hht_alpha(-0.1);
+    p.step(2.e-3, f);
+    REQUIRE(3 == p.get_num_factorization());
+    REQUIRE(2001 == p.get_num_step());
+    // Damped response tends to static solution.
+    for (int i = 0; i < n; i++) REQUIRE(p.get_disp()(i) == Approx(1.e-3).epsilon(1.e-4));
+}
+
+TEST_CASE("numerical dissipation", "[TimeIntegrator]") {
+    const double k{1.e8}, m{1.0};
+    vecX_<double> u0 = vecX_<double>::Constant(1, 1.0), zero = vecX_<double>::Zero(1);
+    TimeIntegrator<double> p0, p1;
+    p0.load(diag_matrix(1, k), diag_matrix(1, m));
+    p1.load(diag_matrix(1, k), diag_matrix(1, m));
+    p1.set_hht_alpha(-0.3);
+    p0.init(u0, zero, zero);
+    p1.init(u0, zero, zero);
+    // Time step far larger than period of stiff mode.
+    for (int i = 0; i < 50; i++) {
+        p0.step(1.e-2, zero);
+        p1.step(1.e-2, zero);
+    }
+    auto energy = [k, m] (const TimeIntegrator<double> &p) {
+        return 0.5*k*p.get_disp()(0)*p.get_disp()(0)+0.5*m*p.get_vel()(0)*p.get_vel()(0);
+    };
+    REQUIRE(energy(p0) == Approx(0.5*k).epsilon(1.e-6));
+    REQUIRE(energy(p1) < 1.e-3*0.5*k);
+}
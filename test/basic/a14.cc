@@ -0,0 +1,103 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "cafea/base/response_spectrum.hpp"
+
+using namespace cafea;
+
+namespace {
+Eigen::SparseMatrix<double> diag_matrix(const std::vector<double> &val) {
+    const int n = static_cast<int>(val.size());
+    Eigen::SparseMatrix<double> A(n, n);
+    std::vector<Eigen::Triplet<double>> tri_list;
+    for (int i = 0; i < n; i++) tri_list.emplace_back(i, i, val[i]);
+    A.setFromTriplets(tri_list.begin(), tri_list.end());
+    return A;
+}
+}
+
+TEST_CASE("participation", "[ResponseSpectrum]") {
+    // Mass orthogonal modes of diag(2, 3).
+    matrix_<double> shape(2, 2), dir(2, 2);
+    shape << 1.0, 3.0, 1.0, -2.0;
+    dir << 1.0, 1.0, 1.0, 0.0;
+    vecX_<double> freq(2);
+    freq << 5.0, 20.0;
+    ResponseSpectrum<double> p;
+    p.load(shape, freq, diag_matrix({2.0, 3.0}), dir, false);
+    REQUIRE(2 == p.get_num_mode());
+    REQUIRE(2 == p.get_num_dir());
+    REQUIRE(p.get_generalized_mass()(0) == Approx(5.0));
+    REQUIRE(p.get_generalized_mass()(1) == Approx(30.0));
+    REQUIRE(p.get_participation()(0, 0) == Approx(1.0));
+    REQUIRE(p.get_participation()(1, 0) == Approx(0.0).margin(1.e-12));
+    REQUIRE(p.get_participation()(0, 1) == Approx(0.4));
+    REQUIRE(p.get_participation()(1, 1) == Approx(0.2));
+    REQUIRE(p.get_effective_mass()(0, 1) == Approx(0.8));
+    REQUIRE(p.get_effective_mass()(1, 1) == Approx(1.2));
+    for (int j = 0; j < 2; j++) {
+        REQUIRE(p.get_effective_mass().col(j).sum() == Approx(p.get_total_mass()(j)));
+    }
+    // Mass normalized modes give same effective mass.
+    matrix_<double> phi = shape;
+    phi.col(0) /= std::sqrt(5.0);
+    phi.col(1) /= std::sqrt(30.0);
+    ResponseSpectrum<double> p2;
+    p2.load(phi, freq, diag_matrix({2.0, 3.0}), dir);
+    REQUIRE(p2.get_effective_mass().isApprox(p.get_effective_mass()));
+}
+
+TEST_CASE("spectrum", "[ResponseSpectrum]") {
+    ResponseSpectrum<double> p;
+    vecX_<double> f(3), a(3);
+    f << 10.0, 1.0, 30.0;
+    a << 4.0, 2.0, 1.0;
+    p.set_spectrum(1, f, a);
+    REQUIRE(0.0 == p.get_accel(0, 5.0));
+    REQUIRE(2.0 == p.get_accel(1, 0.5));
+    REQUIRE(3.0 == Approx(p.get_accel(1, 5.5)));
+    REQUIRE(2.5 == Approx(p.get_accel(1, 20.0)));
+    REQUIRE(1.0 == p.get_accel(1, 50.0));
+}
+
+TEST_CASE("combination", "[ResponseSpectrum]") {
+    const int n{3};
+    matrix_<double> shape = matrix_<double>::Identity(n, n), dir = matrix_<double>::Ones(n, 1);
+    vecX_<double> freq(n), f(2), a(2);
+    freq << 10.0, 10.5, 40.0;
+    f << 0.1, 100.0;
+    a << 9.8, 9.8;
+    ResponseSpectrum<double> p;
+    p.load(shape, freq, diag_matrix({1.0, 1.0, 1.0}), dir);
+    p.set_spectrum(0, f, a);
+    auto q = p.get_modal_coord();
+    for (int i = 0; i < n; i++) {
+        double w = 2.0*PI<double>()*freq(i);
+        REQUIRE(q(i, 0) == Approx(9.8/w/w));
+    }
+    // Rows more than one block of threads.
+    const int num{1000};
+    matrix_<double> resp = matrix_<double>::Random(num, n);
+    auto srss = p.combine(resp);
+    REQUIRE(num == srss.rows());
+    REQUIRE(1 == srss.cols());
+    p.set_method(ModeCombination::CQC);
+    auto rho = p.get_correlation();
+    REQUIRE(rho(0, 1) > 0.5);
+    REQUIRE(rho(0, 2) < 1.e-2);
+    auto cqc = p.combine(resp);
+    p.set_method(ModeCombination::GROUPING);
+    REQUIRE(1.0 == p.get_correlation()(0, 1));
+    REQUIRE(0.0 == p.get_correlation()(1, 2));
+    auto grp = p.combine(resp);
+    for (int k = 0; k < num; k++) {
+        vecX_<double> x = resp.row(k).transpose().cwiseProduct(q.col(0));
+        REQUIRE(srss(k, 0) == Approx(x.norm()));
+        REQUIRE(cqc(k, 0) == Approx(std::sqrt(x.dot(rho*x))));
+        double r2 = x.squaredNorm()+2.0*std::fabs(x(0)*x(1));
+        REQUIRE(grp(k, 0) == Approx(std::sqrt(r2)));
+    }
+}
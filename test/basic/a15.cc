@@ -0,0 +1,77 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+static_assert(12 == ElementAttr::get_matrix_dim<ElementType::PIPE16>());
+static_assert(12 == ElementAttr::get_matrix_dim<ElementType::PIPE18>());
+static_assert(12 == ElementAttr::get_matrix_dim<ElementType::COMBIN14>());
+static_assert(6 == ElementAttr::get_matrix_dim<ElementType::MASS21>());
+
+TEST_CASE("pipe16", "[ElementKernel]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 1.e3f, 1.e6f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 1.f, 2.f, 3.f}};
+    int opt[10] = {0};
+    elem_kernel_<double, ElementType::PIPE16> ke;
+    ElementProperty<double> attr;
+    StructuralElement<float, double>::pipe16(&pt[0], &pt[1], &matl, &sect, opt, ke, attr);
+    auto [stif, mass, tran, rhs, attr2] = StructuralElement<float, double>::pipe16(&pt[0], &pt[1], &matl, &sect, opt);
+    REQUIRE(stif == ke.stif);
+    REQUIRE(mass == ke.mass);
+    REQUIRE(tran == ke.tran);
+    REQUIRE(rhs == ke.rhs);
+    REQUIRE(attr == attr2);
+    REQUIRE(ke.stif.isApprox(ke.stif.transpose()));
+    REQUIRE(ke.mass.isApprox(ke.mass.transpose()));
+    REQUIRE((ke.tran*ke.tran.transpose()).isIdentity(1.e-6));
+
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+    elem.form_matrix<float>(pt, &matl, &sect);
+    REQUIRE(elem.get_stif() == ke.stif);
+    matN_<double, 12> k, m;
+    vecN_<double, 12> r;
+    elem.get_global_matrix(k, m, r);
+    const auto &t = elem.get_tran();
+    matrix_<double> k2 = t.transpose()*elem.get_stif()*t;
+    REQUIRE(k.isApprox(k2));
+    REQUIRE(r.isApprox(t.transpose()*elem.get_rhs()));
+}
+
+TEST_CASE("pipe18", "[ElementKernel]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 0.f});
+    std::vector<Node<float, double>> pt{{1, 1.f, 0.f, 0.f}, {2, 0.f, 1.f, 0.f}, {3, 0.f, 0.f, 0.f}};
+    elem_kernel_<double, ElementType::PIPE18> ke;
+    ElementProperty<double> attr;
+    StructuralElement<float, double>::pipe18(&pt[0], &pt[1], &pt[2], &matl, &sect, ke, attr);
+    REQUIRE(ke.stif.isApprox(ke.stif.transpose(), 1.e-6));
+    REQUIRE(attr.get(ElementProp::ANGLE) == Approx(0.5*PI<double>()));
+    REQUIRE(attr.get(ElementProp::LENGTH) == Approx(0.5*PI<double>()));
+    // Rigid body translation is free of force.
+    vecN_<double, 12> u = vecN_<double, 12>::Zero();
+    for (int i: {0, 6}) u(i) = 1.0;
+    REQUIRE((ke.stif*(ke.tran*u)).norm() < 1.e-6*ke.stif.norm());
+}
+
+TEST_CASE("mass21 and combin14", "[ElementKernel]") {
+    Material<float> spring(1, MaterialType::SPRING_STIFFNESS, {1.e4f, 2.e3f});
+    Section<float> sect(1, SectionType::MASS, {5.f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 0.f, 0.f, 2.f}};
+    int opt[10] = {0};
+    elem_kernel_<double, ElementType::MASS21> km;
+    elem_kernel_<double, ElementType::COMBIN14> ks;
+    ElementProperty<double> attr;
+    StructuralElement<float, double>::mass21(&pt[0], &spring, &sect, opt, km, attr);
+    REQUIRE(5.0 == km.mass.trace()/3.0);
+    REQUIRE(km.tran.isIdentity());
+    StructuralElement<float, double>::combin14(&pt[0], &pt[1], &spring, &sect, opt, ks, attr);
+    REQUIRE(1.e4 == ks.stif(0, 0));
+    REQUIRE(-1.e4 == ks.stif(0, 6));
+    REQUIRE(2.e3 == ks.stif(3, 3));
+    REQUIRE(0.0 == ks.mass.norm());
+}
@@ -0,0 +1,56 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+TEST_CASE("record", "[ElementProperty]") {
+    ElementProperty<double> p;
+    REQUIRE(p.empty());
+    REQUIRE(15 == p.size());
+    REQUIRE(-1.0 == p.get(ElementProp::ANGLE, -1.0));
+    p.set(ElementProp::ANGLE, 0.5);
+    p.set({{ElementProp::OD, 0.2}, {ElementProp::ID, 0.18}});
+    REQUIRE(p.has(ElementProp::ANGLE));
+    REQUIRE(!p.has(ElementProp::IY));
+    REQUIRE(0.5 == p.get(ElementProp::ANGLE, -1.0));
+    REQUIRE(0.0 == p.get(ElementProp::IY));
+    auto view = p.to_map();
+    REQUIRE(3 == view.size());
+    REQUIRE(0.2 == view["OuterDiameter"]);
+    REQUIRE(0.18 == view["InnerDiameter"]);
+    REQUIRE(0.5 == view["Angle"]);
+    p.assign({{ElementProp::MASS, 2.0}});
+    REQUIRE(!p.has(ElementProp::ANGLE));
+    REQUIRE(1 == p.to_map().size());
+    p.clear();
+    REQUIRE(p.empty());
+}
+
+TEST_CASE("pipe", "[ElementProperty]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 1.e3f, 1.e6f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 0.f, 0.f, 2.f}};
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+    elem.form_matrix<float>(pt, &matl, &sect);
+    const auto &p = elem.get_property();
+    REQUIRE(p.get(ElementProp::LENGTH) == Approx(2.0));
+    REQUIRE(p.get(ElementProp::OD) == Approx(0.2));
+    REQUIRE(p.get(ElementProp::THICK) == Approx(0.01));
+    REQUIRE(p.get(ElementProp::PRESIN) == Approx(1.e6));
+    REQUIRE(p.get(ElementProp::SIF) == 1.0);
+    REQUIRE(15 == p.to_map().size());
+    // Axial force only gives direct stress.
+    vecX_<double> x = vecX_<double>::Zero(12);
+    x(8) = 1.e-4;
+    matrix_<double> f = elem.get_member_force(x);
+    REQUIRE(12 == f.rows());
+    matrix_<double> force(6, 2);
+    force.col(0) = f.col(0).head(6).cwiseAbs();
+    force.col(1) = f.col(0).tail(6).cwiseAbs();
+    elem.post_stress_peak(force);
+    double aw = p.get(ElementProp::AW);
+    REQUIRE(elem.get_result()(6, 0) == Approx(force(0, 0)/aw));
+    REQUIRE(elem.get_result()(7, 0) == Approx(0.0).margin(1.e-6));
+}
@@ -0,0 +1,58 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <Eigen/Geometry>
+
+#include "cafea/base/block_tran.hpp"
+
+using namespace cafea;
+
+namespace {
+matrix_<double> block_rotation(int nb) {
+    matrix_<double> t = matrix_<double>::Zero(3*nb, 3*nb);
+    for (int i = 0; i < nb; i++) {
+        Eigen::Vector3d axis(1.0, 2.0, 0.5+i);
+        t.block(3*i, 3*i, 3, 3) = Eigen::AngleAxisd(0.3*(i+1), axis.normalized()).toRotationMatrix();
+    }
+    return t;
+}
+}
+
+TEST_CASE("pattern", "[BlockTran]") {
+    REQUIRE(TranPattern::IDENTITY == BlockTran<double>::get_pattern(matrix_<double>::Identity(6, 6)));
+    matrix_<double> t = block_rotation(4);
+    REQUIRE(TranPattern::BLOCK_DIAGONAL == BlockTran<double>::get_pattern(t));
+    t(0, 5) = 1.e-3;
+    REQUIRE(TranPattern::DENSE == BlockTran<double>::get_pattern(t));
+    REQUIRE(TranPattern::DENSE == BlockTran<double>::get_pattern(matrix_<double>::Identity(4, 4)*2.0));
+    REQUIRE(TranPattern::IDENTITY == BlockTran<float>::get_pattern(matrix_<float>::Identity(4, 4)));
+}
+
+TEST_CASE("transform", "[BlockTran]") {
+    for (int nb: {4, 16}) {
+        const int n = 3*nb;
+        matrix_<double> t = block_rotation(nb);
+        matrix_<double> k = matrix_<double>::Random(n, n), m = matrix_<double>::Random(n, n);
+        vecX_<double> r = vecX_<double>::Random(n);
+        matrix_<double> kg(n, n), mg(n, n);
+        vecX_<double> rg(n);
+        for (auto pat: {TranPattern::BLOCK_DIAGONAL, TranPattern::DENSE}) {
+            BlockTran<double>::transform(t, pat, k, m, r, kg, mg, rg);
+            REQUIRE(kg.isApprox(t.transpose()*k*t));
+            REQUIRE(mg.isApprox(t.transpose()*m*t));
+            REQUIRE(rg.isApprox(t.transpose()*r));
+        }
+        matrix_<double> x = matrix_<double>::Random(n, 5), y(n, 5);
+        BlockTran<double>::apply(t, TranPattern::BLOCK_DIAGONAL, x, y);
+        REQUIRE(y.isApprox(t*x));
+        BlockTran<double>::apply_transpose(t, TranPattern::BLOCK_DIAGONAL, x, y);
+        REQUIRE(y.isApprox(t.transpose()*x));
+    }
+    // Fixed size output and identity copy.
+    matN_<double, 6> k = matN_<double, 6>::Random(), kg, mg;
+    vecN_<double, 6> r = vecN_<double, 6>::Random(), rg;
+    BlockTran<double>::transform(matrix_<double>::Identity(6, 6), TranPattern::IDENTITY, k, k, r, kg, mg, rg);
+    REQUIRE(kg == k);
+    REQUIRE(mg == k);
+    REQUIRE(rg == r);
+}
@@ -0,0 +1,44 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+TEST_CASE("pipe16", "[PipeBatch]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 1.e3f, 1.e6f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 1.f, 2.f, 3.f},
+        {3, 1.f, 2.f, 5.f}, {4, 1.f, 2.f, 1.f}, {5, -2.f, 0.5f, 1.f}};
+    const int opt[2][10] = {{0}, {1}};
+    PipeBatch<float, double> batch;
+    batch.reserve(8);
+    for (int k: {0, 1}) {
+        for (size_t j = 1; j < pt.size(); j++) batch.add(&pt[j-1], &pt[j], &matl, &sect, opt[k]);
+    }
+    REQUIRE(8 == batch.size());
+    batch.evaluate();
+    for (int k: {0, 1}) {
+        for (size_t j = 1; j < pt.size(); j++) {
+            elem_kernel_<double, ElementType::PIPE16> ke, ke2;
+            ElementProperty<double> attr, attr2;
+            StructuralElement<float, double>::pipe16(&pt[j-1], &pt[j], &matl, &sect, opt[k], ke, attr);
+            batch.get_kernel(4*k+j-1, ke2, attr2);
+            REQUIRE(ke2.stif.isApprox(ke.stif, 1.e-6));
+            REQUIRE(ke2.mass.isApprox(ke.mass, 1.e-6));
+            REQUIRE(ke2.tran.isApprox(ke.tran, 1.e-6));
+            REQUIRE(ke2.rhs.isApprox(ke.rhs, 1.e-6));
+            for (auto x: {ElementProp::LENGTH, ElementProp::AW, ElementProp::IY, ElementProp::SIF, ElementProp::ANGLE}) {
+                REQUIRE(attr2.get(x) == Approx(attr.get(x)));
+            }
+        }
+    }
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {2, 3});
+    elem.form_matrix<float>(batch, 1);
+    REQUIRE(TranPattern::BLOCK_DIAGONAL == elem.get_tran_pattern());
+    REQUIRE(elem.get_property().get(ElementProp::LENGTH) == Approx(2.0));
+    batch.clear();
+    REQUIRE(0 == batch.size());
+}
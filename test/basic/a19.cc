@@ -0,0 +1,108 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdio>
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+void require_same(const Element<double> &a, const Element<double> &b) {
+    matN_<double, 12> k, m, k2, m2;
+    vecN_<double, 12> r, r2;
+    a.get_global_matrix(k, m, r);
+    b.get_global_matrix(k2, m2, r2);
+    REQUIRE(a.get_stif().isApprox(b.get_stif()));
+    REQUIRE(a.get_tran().isApprox(b.get_tran()));
+    REQUIRE(k.isApprox(k2));
+    REQUIRE(m.isApprox(m2));
+    REQUIRE((r-r2).norm() <= 1.e-12*(1.0+r.norm()));
+    REQUIRE(a.get_property() == b.get_property());
+    REQUIRE(a.get_tran_pattern() == b.get_tran_pattern());
+}
+}
+
+TEST_CASE("pipe16", "[ElementCache]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 2.f, 0.f, 0.f}, {3, 2.f, 2.f, 0.f},
+        {4, 2.f, 2.f, 2.f}, {5, 2.f, 2.f, 5.f}};
+    ElementCache<double> cache;
+    for (size_t j = 1; j < pt.size(); j++) {
+        Node<float, double> p[2] = {pt[j-1], pt[j]};
+        Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2}), ref(1, ElementType::PIPE16, 1, 1, {1, 2});
+        elem.form_matrix<float>(p, &matl, &sect, cache);
+        ref.form_matrix<float>(p, &matl, &sect);
+        require_same(elem, ref);
+    }
+    // Three pipes of length 2 share one entry.
+    REQUIRE(2 == cache.size());
+    REQUIRE(2 == cache.get_num_hit());
+    REQUIRE(2 == cache.get_num_miss());
+    REQUIRE(0.5 == cache.get_hit_rate());
+    REQUIRE(0 < cache.get_memory_size());
+    // Options are part of key.
+    Node<float, double> p[2] = {pt[0], pt[1]};
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2}), ref(1, ElementType::PIPE16, 1, 1, {1, 2});
+    elem.set_lumped_mass(true);
+    ref.set_lumped_mass(true);
+    elem.form_matrix<float>(p, &matl, &sect, cache);
+    ref.form_matrix<float>(p, &matl, &sect);
+    require_same(elem, ref);
+    REQUIRE(3 == cache.size());
+    cache.print_stats();
+}
+
+TEST_CASE("pipe18 and mass21", "[ElementCache]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 0.f});
+    Node<float, double> pt[2][3] = {{{1, 1.f, 0.f, 0.f}, {2, 0.f, 1.f, 0.f}, {3, 0.f, 0.f, 0.f}},
+        {{1, 0.f, 0.f, 1.f}, {2, 0.f, 1.f, 0.f}, {3, 0.f, 0.f, 0.f}}};
+    ElementCache<double> cache;
+    for (int j: {0, 1}) {
+        Element<double> elem(1, ElementType::PIPE18, 1, 1, {1, 2, 3}), ref(1, ElementType::PIPE18, 1, 1, {1, 2, 3});
+        elem.form_matrix<float>(pt[j], &matl, &sect, cache);
+        ref.form_matrix<float>(pt[j], &matl, &sect);
+        require_same(elem, ref);
+    }
+    REQUIRE(1 == cache.size());
+    REQUIRE(1 == cache.get_num_hit());
+    // Mass element is formed without cache.
+    Section<float> ms(2, SectionType::MASS, {5.f});
+    Element<double> elem(2, ElementType::MASS21, 1, 2, {1});
+    elem.form_matrix<float>(pt[0], &matl, &ms, cache);
+    REQUIRE(5.0 == elem.get_mass().trace()/3.0);
+    REQUIRE(1 == cache.size());
+    REQUIRE(2 == cache.get_num_hit()+cache.get_num_miss());
+}
+
+TEST_CASE("persistence", "[ElementCache]") {
+    const char *fn = "a19_cache.bin";
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 0.f, 1.e6f});
+    Node<float, double> p[2] = {{1, 0.f, 0.f, 0.f}, {2, 1.f, 2.f, 3.f}};
+    Element<double> ref(1, ElementType::PIPE16, 1, 1, {1, 2});
+    {
+        ElementCache<double> cache;
+        cache.set_tolerance(1.e-5);
+        ref.form_matrix<float>(p, &matl, &sect, cache);
+        REQUIRE(cache.save(fn));
+    }
+    ElementCache<double> cache;
+    REQUIRE(cache.load(fn));
+    REQUIRE(1 == cache.size());
+    REQUIRE(1.e-5 == cache.get_tolerance());
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+    elem.form_matrix<float>(p, &matl, &sect, cache);
+    REQUIRE(1 == cache.get_num_hit());
+    REQUIRE(0 == cache.get_num_miss());
+    require_same(elem, ref);
+    // File of other scalar type is rejected.
+    ElementCache<float> cache2;
+    REQUIRE_FALSE(cache2.load(fn));
+    REQUIRE(0 == cache2.size());
+    REQUIRE_FALSE(cache2.load("a19_missing.bin"));
+    std::remove(fn);
+}
@@ -0,0 +1,67 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+static_assert(19 == registered_element_list_::size());
+static_assert(ElementTraits<ElementType::PIPE16>::has_kernel && ElementTraits<ElementType::PIPE16>::has_stress);
+static_assert(ElementTraits<ElementType::MASS21>::has_kernel && !ElementTraits<ElementType::MASS21>::has_stress);
+static_assert(!ElementTraits<ElementType::C3D4>::has_kernel);
+static_assert(!ElementTraits<ElementType::UNKNOWN>::has_kernel);
+static_assert(3 == ElementAttr::get_num_of_node(ElementType::PIPE18));
+static_assert(2 == ElementAttr::get_active_num_of_node(ElementType::PIPE18));
+static_assert(3 == ElementAttr::get_dofs_per_node(ElementType::C3D20));
+static_assert(0 == ElementAttr::get_dofs_per_node(ElementType::UNKNOWN));
+static_assert(ElementAttr::has_kernel(ElementType::COMBIN14));
+static_assert(ElementAttr::has_kernel(ElementType::S9R) && !ElementAttr::has_kernel(ElementType::B31));
+
+TEST_CASE("attribute", "[ElementRegistry]") {
+    size_t num{0};
+    registered_element_list_::for_each([&num] (auto tag) {
+        using traits_ = ElementTraits<decltype(tag)::value>;
+        REQUIRE(traits_::num_active_node <= traits_::num_node);
+        REQUIRE(traits_::num_active_node == ElementAttr::get_active_num_of_node(tag.value));
+        REQUIRE(traits_::order == ElementAttr::get_element_order(tag.value));
+        REQUIRE(traits_::type_id == ElementAttr::get_element_type_id(tag.value));
+        if (traits_::is_ansys) REQUIRE(tag.value == ElementAttr::get_element_type(traits_::type_id));
+        num++;
+    });
+    REQUIRE(registered_element_list_::size() == num);
+    REQUIRE(ElementType::UNKNOWN == ElementAttr::get_element_type(0));
+    REQUIRE(ElementType::UNKNOWN == ElementAttr::get_element_type(20));
+    REQUIRE(ElementType::SOLID185 == ElementAttr::get_element_type(185));
+    REQUIRE_FALSE(registered_element_list_::visit(ElementType::UNKNOWN, [] (auto) {}));
+}
+
+TEST_CASE("dispatch", "[ElementRegistry]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 1.e3f, 1.e6f});
+    std::vector<Node<float, double>> pt{{1, 0.f, 0.f, 0.f}, {2, 1.f, 2.f, 3.f}};
+    Element<double> elem(1, 1, 1);
+    elem.set_element_type(16);
+    REQUIRE(ElementType::PIPE16 == elem.get_element_type());
+    elem.set_node_list({1, 2});
+    elem.form_matrix<float>(pt, &matl, &sect);
+    elem_kernel_<double, ElementType::PIPE16> ke;
+    ElementProperty<double> attr;
+    int opt[10] = {0};
+    StructuralElement<float, double>::pipe16(&pt[0], &pt[1], &matl, &sect, opt, ke, attr);
+    REQUIRE(elem.get_stif() == ke.stif);
+    REQUIRE(elem.get_property() == attr);
+    // Member force of rigid body translation is zero.
+    matrix_<double> x = matrix_<double>::Zero(12, 1);
+    x(0, 0) = x(6, 0) = 1.0;
+    auto f = elem.get_member_force(x);
+    REQUIRE(12 == f.rows());
+    REQUIRE(f.norm() < 1.e-6*elem.get_stif().norm());
+    // Unsupported type keeps empty matrix.
+    Element<double> solid(2, 1, 1);
+    solid.set_element_type(ElementType::C3D4);
+    solid.form_matrix<float>(pt, &matl, &sect);
+    REQUIRE(0 == solid.get_matrix_shape()[0]);
+    REQUIRE(0 == solid.get_member_force(x).size());
+}
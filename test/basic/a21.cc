@@ -0,0 +1,106 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cmath>
+
+#include "cafea/utils/shape_function.hpp"
+
+using namespace cafea;
+
+namespace {
+// Tables are constant expressions.
+static_assert(gauss_rule_v<3>.wt[1] > 0.88 && gauss_rule_v<3>.wt[1] < 0.89, "Weight of 3-point rule.");
+static_assert(0.0 == gauss_rule_v<5>.pt[2][0], "Middle point of odd rule.");
+static_assert(27 == shape_table_v<ShapeType::HEX20, 3>.num_point, "Size of 3-D rule.");
+
+template <ShapeType ST, size_t NG>
+void check_table() {
+    constexpr auto &tab = shape_table_v<ST, NG>;
+    for (size_t g = 0; g < tab.num_point; g++) {
+        double sum{0.0};
+        for (auto x: tab.shp[g]) sum += x;
+        REQUIRE(1.0 == Approx(sum));
+        for (size_t d = 0; d < tab.dim; d++) {
+            double dsum{0.0};
+            for (auto x: tab.dshp[g][d]) dsum += x;
+            REQUIRE(0.0 == Approx(dsum).margin(1.e-12));
+        }
+    }
+    double vol{0.0};
+    for (auto w: tab.rule.wt) vol += w;
+    REQUIRE(std::pow(2.0, tab.dim) == Approx(vol));
+    // Kronecker delta at nodes.
+    using func_ = ShapeFunction<ST>;
+    for (size_t i = 0; i < func_::num_node; i++) {
+        typename func_::point_ x{};
+        for (size_t d = 0; d < func_::dim; d++) x[d] = ShapeNodes<ST>::coord[i][d];
+        auto shp = func_::value(x);
+        for (size_t j = 0; j < func_::num_node; j++) {
+            REQUIRE((i == j ? 1.0: 0.0) == Approx(shp[j]).margin(1.e-14));
+        }
+    }
+}
+
+// Central difference of shape function.
+template <ShapeType ST>
+void check_deriv() {
+    using func_ = ShapeFunction<ST>;
+    typename func_::point_ x{};
+    for (size_t d = 0; d < func_::dim; d++) x[d] = 0.3-0.2*d;
+    auto dshp = func_::deriv(x);
+    for (size_t d = 0; d < func_::dim; d++) {
+        auto xp = x, xm = x;
+        xp[d] += 1.e-6;
+        xm[d] -= 1.e-6;
+        auto sp = func_::value(xp), sm = func_::value(xm);
+        for (size_t i = 0; i < func_::num_node; i++) {
+            REQUIRE(dshp[d][i] == Approx((sp[i]-sm[i])/2.e-6).margin(1.e-8));
+        }
+    }
+}
+}
+
+TEST_CASE("Gauss Legendre rule", "[Utility]") {
+    SECTION("Exact polynomial") {
+        // n-point rule integrates x^(2n-1) exactly.
+        constexpr auto &r = gauss_rule_v<6>;
+        for (int k = 0; k < 12; k++) {
+            double val{0.0};
+            for (size_t i = 0; i < r.size(); i++) val += r.wt[i]*std::pow(r.pt[i][0], k);
+            REQUIRE((0 == k%2 ? 2.0/(k+1): 0.0) == Approx(val).margin(1.e-14));
+        }
+    }
+    SECTION("Tensor product") {
+        constexpr auto &r = gauss_rule_v<2, 3>;
+        REQUIRE(8 == r.size());
+        double val{0.0};
+        for (size_t i = 0; i < r.size(); i++) val += r.wt[i]*r.pt[i][0]*r.pt[i][0]*r.pt[i][2]*r.pt[i][2];
+        REQUIRE(4.0/9.0*2.0 == Approx(val));
+        // First coordinate runs fastest.
+        REQUIRE(r.pt[0][0] < r.pt[1][0]);
+        REQUIRE(r.pt[0][1] == r.pt[1][1]);
+        REQUIRE(r.pt[0][2] == r.pt[3][2]);
+    }
+    SECTION("Same as former runtime rule") {
+        auto [pt, wt] = gauss_quad<4, float>();
+        constexpr auto &r = gauss_rule_v<4, 1, float>;
+        for (size_t i = 0; i < 4; i++) {
+            REQUIRE(pt(i) == r.pt[i][0]);
+            REQUIRE(wt(i) == r.wt[i]);
+        }
+    }
+}
+
+TEST_CASE("Shape function", "[Utility]") {
+    check_table<ShapeType::LINE2, 2>();
+    check_table<ShapeType::LINE3, 3>();
+    check_table<ShapeType::QUAD4, 2>();
+    check_table<ShapeType::QUAD8, 3>();
+    check_table<ShapeType::QUAD9, 3>();
+    check_table<ShapeType::HEX8, 2>();
+    check_table<ShapeType::HEX20, 3>();
+    check_deriv<ShapeType::QUAD8>();
+    check_deriv<ShapeType::QUAD9>();
+    check_deriv<ShapeType::HEX8>();
+    check_deriv<ShapeType::HEX20>();
+}
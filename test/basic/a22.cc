@@ -0,0 +1,126 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <map>
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+const double young{2.e11}, dens{7.8e3}, thick{.1};
+
+// Six rigid body modes of nodes.
+matrix_<double> rigid_modes(const std::vector<Node<double, double>> &pt) {
+    matrix_<double> res = matrix_<double>::Zero(6*pt.size(), 6);
+    for (size_t i = 0; i < pt.size(); i++) {
+        auto x = pt[i].get_xyz();
+        for (int d = 0; d < 3; d++) {
+            res(6*i+d, d) = 1.0;
+            res(6*i+3+d, 3+d) = 1.0;
+            vec3_<double> e = vec3_<double>::Unit(d);
+            res.block(6*i, 3+d, 3, 1) = e.cross(x);
+        }
+    }
+    return res;
+}
+
+// Cantilever strip along x clamped at x=0, tip deflection under unit load in z.
+template <ElementType ET>
+double cantilever(int ne, double len, double width) {
+    constexpr bool nine = ElementType::S9R == ET;
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {dens, young, 0., 0.});
+    Section<double> sect(1, SectionType::SHELL, {thick});
+    // Grid of (2*ne+1) x 3 points, node id of point.
+    std::map<std::pair<int, int>, int> id;
+    std::vector<Node<double, double>> pt;
+    for (int i = 0; i <= 2*ne; i++) {
+        for (int j = 0; j < 3; j++) {
+            if (!nine && 1 == i%2 && 1 == j) continue;
+            id[{i, j}] = static_cast<int>(pt.size());
+            pt.emplace_back(static_cast<int>(pt.size())+1, len*i/(2*ne), width*j/2, 0.);
+        }
+    }
+    const int dim = 6*static_cast<int>(pt.size());
+    matrix_<double> kg = matrix_<double>::Zero(dim, dim);
+    for (int e = 0; e < ne; e++) {
+        const int i = 2*e;
+        std::vector<int> loc{id[{i, 0}], id[{i+2, 0}], id[{i+2, 2}], id[{i, 2}],
+            id[{i+1, 0}], id[{i+2, 1}], id[{i+1, 2}], id[{i, 1}]};
+        if (nine) loc.push_back(id[{i+1, 1}]);
+        std::vector<Node<double, double>> p;
+        for (auto k: loc) p.push_back(pt[k]);
+        Element<double> elem(e+1, ET, 1, 1, {1});
+        elem.form_matrix<double>(p.data(), &matl, &sect);
+        matrix_<double> k, m;
+        vecX_<double> r;
+        elem.get_global_matrix(k, m, r);
+        for (size_t a = 0; a < loc.size(); a++) {
+            for (size_t b = 0; b < loc.size(); b++) {
+                kg.block(6*loc[a], 6*loc[b], 6, 6) += k.block(6*a, 6*b, 6, 6);
+            }
+        }
+    }
+    vecX_<double> f = vecX_<double>::Zero(dim);
+    f(6*id[{2*ne, 0}]+2) = f(6*id[{2*ne, 2}]+2) = 1./6.;
+    f(6*id[{2*ne, 1}]+2) = 4./6.;
+    for (int j = 0; j < 3; j++) {
+        for (int d = 0; d < 6; d++) kg(6*id[{0, j}]+d, 6*id[{0, j}]+d) += 1.e30;
+    }
+    vecX_<double> x = kg.ldlt().solve(f);
+    return x(6*id[{2*ne, 1}]+2);
+}
+}
+
+TEST_CASE("registry", "[Shell]") {
+    REQUIRE(ElementAttr::has_kernel(ElementType::S8R));
+    REQUIRE(ElementAttr::has_kernel(ElementType::S9R));
+    REQUIRE(ElementAttr::has_kernel(ElementType::SHELL281));
+    REQUIRE(48 == ElementAttr::get_matrix_dim<ElementType::S8R>());
+    REQUIRE(54 == ElementAttr::get_matrix_dim<ElementType::S9R>());
+}
+
+TEST_CASE("rigid body and mass", "[Shell]") {
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {dens, young, 0., .3});
+    Section<double> sect(1, SectionType::SHELL, {thick});
+    // Curved and distorted element in space.
+    std::vector<Node<double, double>> pt{{1, 0., 0., 0.}, {2, 2., .2, .1}, {3, 2.2, 1.9, .4}, {4, -.1, 2., .2},
+        {5, 1., 0., .2}, {6, 2.1, 1., .35}, {7, 1., 2., .5}, {8, 0., 1., .3}, {9, 1., 1., .45}};
+    const double area_ref = 4.0;
+    for (auto et: {ElementType::S8R, ElementType::S9R}) {
+        const size_t nn = ElementType::S9R == et ? 9: 8;
+        std::vector<Node<double, double>> p(pt.begin(), pt.begin()+nn);
+        Element<double> elem(1, et, 1, 1, {1});
+        elem.form_matrix<double>(p.data(), &matl, &sect);
+        const auto &k = elem.get_stif();
+        const auto &m = elem.get_mass();
+        REQUIRE(static_cast<int>(6*nn) == k.rows());
+        REQUIRE((k-k.transpose()).norm() <= 1.e-12*k.norm());
+        auto rb = rigid_modes(p);
+        REQUIRE((k*rb).norm() <= 1.e-8*k.norm());
+        // Total mass in each direction.
+        auto attr = elem.get_property();
+        const double ms = attr.get(ElementProp::MASS);
+        REQUIRE(area_ref == Approx(attr.get(ElementProp::AREA)).epsilon(.1));
+        for (int d = 0; d < 3; d++) {
+            REQUIRE(ms == Approx(rb.col(d).dot(m*rb.col(d))));
+        }
+        Element<double> lump(1, et, 1, 1, {1});
+        lump.set_lumped_mass(true);
+        lump.form_matrix<double>(p.data(), &matl, &sect);
+        const auto &ml = lump.get_mass();
+        REQUIRE(ml.isDiagonal());
+        REQUIRE(0.0 <= ml.diagonal().minCoeff());
+        REQUIRE(ms == Approx(rb.col(2).dot(ml*rb.col(2))));
+        REQUIRE(TranPattern::IDENTITY == elem.get_tran_pattern());
+    }
+}
+
+TEST_CASE("cantilever", "[Shell]") {
+    const double len{4.}, width{1.};
+    const double iy = width*thick*thick*thick/12., ga = young/2.*width*thick*5./6.;
+    const double ref = len*len*len/(3.*young*iy) + len/ga;
+    REQUIRE(ref == Approx(cantilever<ElementType::S8R>(4, len, width)).epsilon(.01));
+    REQUIRE(ref == Approx(cantilever<ElementType::S9R>(4, len, width)).epsilon(.01));
+}
@@ -0,0 +1,149 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <map>
+#include <array>
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+const double young{2.e11}, dens{7.8e3};
+// Natural coordinates of 20-node hexahedron.
+const int hex20[20][3] = {{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+    {-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1},
+    {0, -1, -1}, {1, 0, -1}, {0, 1, -1}, {-1, 0, -1},
+    {0, -1, 1}, {1, 0, 1}, {0, 1, 1}, {-1, 0, 1},
+    {-1, -1, 0}, {1, -1, 0}, {1, 1, 0}, {-1, 1, 0}};
+
+// Distorted hexahedron.
+std::vector<Node<double, double>> distorted(size_t nn) {
+    std::vector<Node<double, double>> res;
+    for (size_t i = 0; i < nn; i++) {
+        const double x = hex20[i][0], y = hex20[i][1], z = hex20[i][2];
+        res.emplace_back(static_cast<int>(i)+1, 1.+x+.1*y*z, 1.5*(1.+y)+.1*x, 1.+z+.05*x*y);
+    }
+    return res;
+}
+
+// Linear field u = A*x of nodes.
+vecX_<double> linear_field(const std::vector<Node<double, double>> &pt, const mat3_<double> &a) {
+    vecX_<double> res(3*pt.size());
+    for (size_t i = 0; i < pt.size(); i++) res.segment<3>(3*i) = a*pt[i].get_xyz();
+    return res;
+}
+
+// Cantilever of unit square section along x clamped at x=0, tip deflection under unit load in z.
+template <ElementType ET>
+double cantilever(int ne, double len) {
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {dens, young, 0., 0.});
+    Section<double> sect(1, SectionType::SOLID, {0.});
+    // Grid of (2*ne+1) x 3 x 3 points.
+    std::map<std::array<int, 3>, int> id;
+    std::vector<Node<double, double>> pt;
+    for (int i = 0; i <= 2*ne; i++) {
+        for (int j = 0; j < 3; j++) {
+            for (int k = 0; k < 3; k++) {
+                if (1 < (i%2)+(j%2)+(k%2)) continue;
+                id[{i, j, k}] = static_cast<int>(pt.size());
+                pt.emplace_back(static_cast<int>(pt.size())+1, len*i/(2*ne), .5*j, .5*k);
+            }
+        }
+    }
+    const int dim = 3*static_cast<int>(pt.size());
+    matrix_<double> kg = matrix_<double>::Zero(dim, dim);
+    for (int e = 0; e < ne; e++) {
+        std::vector<int> loc;
+        std::vector<Node<double, double>> p;
+        for (auto &c: hex20) {
+            loc.push_back(id[{2*e+1+c[0], 1+c[1], 1+c[2]}]);
+            p.push_back(pt[loc.back()]);
+        }
+        Element<double> elem(e+1, ET, 1, 1, {1});
+        elem.form_matrix<double>(p.data(), &matl, &sect);
+        matrix_<double> k, m;
+        vecX_<double> r;
+        elem.get_global_matrix(k, m, r);
+        for (size_t a = 0; a < loc.size(); a++) {
+            for (size_t b = 0; b < loc.size(); b++) kg.block(3*loc[a], 3*loc[b], 3, 3) += k.block(3*a, 3*b, 3, 3);
+        }
+    }
+    vecX_<double> f = vecX_<double>::Zero(dim);
+    double tip{0.0};
+    for (const auto &it: id) {
+        if (2*ne == it.first[0]) {
+            // Consistent load of uniform shear on 8-node face.
+            const bool corner = 1 != it.first[1] && 1 != it.first[2];
+            f(3*it.second+2) = corner ? -1./12.: 1./3.;
+            tip += f(3*it.second+2);
+        }
+        if (0 == it.first[0]) {
+            for (int d = 0; d < 3; d++) kg(3*it.second+d, 3*it.second+d) += 1.e30;
+        }
+    }
+    REQUIRE(1.0 == Approx(tip));
+    vecX_<double> x = kg.ldlt().solve(f);
+    return .5*(x(3*id[{2*ne, 1, 0}]+2)+x(3*id[{2*ne, 1, 2}]+2));
+}
+}
+
+TEST_CASE("registry", "[Solid]") {
+    for (auto et: {ElementType::SOLID185, ElementType::C3D8, ElementType::SOLID186, ElementType::C3D20}) {
+        REQUIRE(ElementAttr::has_kernel(et));
+        REQUIRE(3 == ElementAttr::get_dofs_per_node(et));
+    }
+    REQUIRE(24 == ElementAttr::get_matrix_dim<ElementType::SOLID185>());
+    REQUIRE(60 == ElementAttr::get_matrix_dim<ElementType::C3D20>());
+}
+
+TEST_CASE("rigid body and patch", "[Solid]") {
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {dens, young, 0., .3});
+    Section<double> sect(1, SectionType::SOLID, {0.});
+    mat3_<double> eps;
+    eps << 1., .2, -.3, .2, -.5, .4, -.3, .4, .7;
+    eps *= 1.e-4;
+    const double lambda = young*.3/(1.3*.4), mu = young/2.6;
+    const double energy = lambda*eps.trace()*eps.trace() + 2.*mu*eps.squaredNorm();
+    for (auto et: {ElementType::SOLID185, ElementType::SOLID186, ElementType::C3D20}) {
+        const size_t nn = ElementType::SOLID185 == et ? 8: 20;
+        auto p = distorted(nn);
+        Element<double> elem(1, et, 1, 1, {1});
+        elem.form_matrix<double>(p.data(), &matl, &sect);
+        const auto &k = elem.get_stif();
+        const auto &m = elem.get_mass();
+        REQUIRE(static_cast<int>(3*nn) == k.rows());
+        REQUIRE((k-k.transpose()).norm() <= 1.e-12*k.norm());
+        for (int d = 0; d < 3; d++) {
+            mat3_<double> rot = mat3_<double>::Zero();
+            rot((d+1)%3, (d+2)%3) = 1.;
+            rot((d+2)%3, (d+1)%3) = -1.;
+            REQUIRE((k*linear_field(p, rot)).norm() <= 1.e-8*k.norm());
+            REQUIRE((k*linear_field(p, mat3_<double>::Identity())).norm() >= 1.e-3*k.norm());
+        }
+        // Constant strain is integrated exactly.
+        const double vol = elem.get_property().get(ElementProp::VOLUME);
+        auto u = linear_field(p, eps);
+        REQUIRE(vol*energy == Approx(u.dot(k*u)));
+        // Total mass in each direction.
+        for (int d = 0; d < 3; d++) {
+            vecX_<double> r = vecX_<double>::Zero(3*nn);
+            for (size_t i = 0; i < nn; i++) r(3*i+d) = 1.;
+            REQUIRE(dens*vol == Approx(r.dot(m*r)));
+        }
+        Element<double> lump(1, et, 1, 1, {1});
+        lump.set_lumped_mass(true);
+        lump.form_matrix<double>(p.data(), &matl, &sect);
+        REQUIRE(lump.get_mass().isDiagonal());
+        REQUIRE(0.0 < lump.get_mass().diagonal().minCoeff());
+        REQUIRE(dens*vol == Approx(lump.get_mass().trace()/3.));
+    }
+}
+
+TEST_CASE("cantilever", "[Solid]") {
+    const double len{8.}, ga = young/2.*5./6.;
+    const double ref = len*len*len/(3.*young/12.) + len/ga;
+    REQUIRE(ref == Approx(cantilever<ElementType::SOLID186>(4, len)).epsilon(.02));
+    REQUIRE(ref == Approx(cantilever<ElementType::C3D20>(4, len)).epsilon(.02));
+}
@@ -0,0 +1,116 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+static_assert(has_request(EvalRequest::ALL, EvalRequest::POST), "All requests.");
+static_assert(!has_request(EvalRequest::STIF | EvalRequest::RHS, EvalRequest::MASS), "Combined requests.");
+static_assert(EvalRequest::STIF == (EvalRequest::STIF | EvalRequest::MASS) - EvalRequest::MASS, "Removed request.");
+
+const auto static_req = EvalRequest::STIF | EvalRequest::RHS | EvalRequest::ATTR | EvalRequest::POST;
+}
+
+TEST_CASE("pipe", "[EvalRequest]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 0.f, 1.e6f});
+    Node<float, double> p[2] = {{1, 0.f, 0.f, 0.f}, {2, 2.f, 1.f, .5f}};
+    Element<double> ref(1, ElementType::PIPE16, 1, 1, {1, 2});
+    ref.form_matrix<float>(p, &matl, &sect);
+    REQUIRE(EvalRequest::ALL == ref.get_eval_request());
+
+    SECTION("static") {
+        Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+        elem.set_eval_request(static_req);
+        elem.form_matrix<float>(p, &matl, &sect);
+        REQUIRE(0 == elem.get_mass().size());
+        REQUIRE(elem.get_stif() == ref.get_stif());
+        REQUIRE(elem.get_rhs() == ref.get_rhs());
+        REQUIRE(elem.get_property() == ref.get_property());
+        matN_<double, 12> k, m, k2, m2;
+        vecN_<double, 12> r, r2;
+        elem.get_global_matrix(k, m, r);
+        ref.get_global_matrix(k2, m2, r2);
+        REQUIRE(k == k2);
+        REQUIRE(r == r2);
+        REQUIRE(m.isZero());
+        matrix_<double> kd, md;
+        vecX_<double> rd;
+        elem.get_global_matrix(kd, md, rd);
+        REQUIRE(kd == k2);
+        REQUIRE(0 == md.size());
+    }
+    SECTION("modal") {
+        Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+        elem.set_eval_request(EvalRequest::MASS | EvalRequest::ATTR);
+        elem.form_matrix<float>(p, &matl, &sect);
+        REQUIRE(has_request(elem.get_eval_request(), EvalRequest::STIF));
+        REQUIRE(0 == elem.get_rhs().size());
+        REQUIRE(elem.get_mass() == ref.get_mass());
+        const auto &attr = elem.get_property();
+        REQUIRE(attr.get(ElementProp::MASS) == ref.get_property().get(ElementProp::MASS));
+        REQUIRE(attr.has(ElementProp::LENGTH));
+        REQUIRE(!attr.has(ElementProp::OD));
+        REQUIRE(!attr.has(ElementProp::SIF));
+    }
+    SECTION("stiffness only") {
+        Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2});
+        elem.set_eval_request(EvalRequest::NONE);
+        elem.form_matrix<float>(p, &matl, &sect);
+        REQUIRE(elem.get_stif() == ref.get_stif());
+        REQUIRE(elem.get_tran() == ref.get_tran());
+        REQUIRE(elem.get_property().empty());
+    }
+}
+
+TEST_CASE("cache", "[EvalRequest]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 0.f, 1.e6f});
+    Node<float, double> p[2] = {{1, 0.f, 0.f, 0.f}, {2, 0.f, 2.f, 0.f}};
+    ElementCache<double> cache;
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1, 2}), ref(1, ElementType::PIPE16, 1, 1, {1, 2});
+    elem.set_eval_request(static_req);
+    elem.form_matrix<float>(p, &matl, &sect, cache);
+    ref.form_matrix<float>(p, &matl, &sect);
+    REQUIRE(0 == elem.get_mass().size());
+    REQUIRE(elem.get_stif().isApprox(ref.get_stif()));
+    // Entry keeps full matrices for later requests.
+    Element<double> full(2, ElementType::PIPE16, 1, 1, {1, 2});
+    full.form_matrix<float>(p, &matl, &sect, cache);
+    REQUIRE(1 == cache.get_num_hit());
+    REQUIRE(full.get_mass().isApprox(ref.get_mass()));
+}
+
+TEST_CASE("solid", "[EvalRequest]") {
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3, 2.e11, 0., .3});
+    Section<double> sect(1, SectionType::SOLID, {0.});
+    std::vector<Node<double, double>> p{{1, 0., 0., 0.}, {2, 1., 0., 0.}, {3, 1.1, 1., 0.}, {4, 0., 1., 0.},
+        {5, 0., 0., 1.}, {6, 1., 0., 1.2}, {7, 1., 1., 1.}, {8, 0., 1., 1.}};
+    Element<double> elem(1, ElementType::SOLID185, 1, 1, {1}), ref(1, ElementType::SOLID185, 1, 1, {1});
+    elem.set_eval_request(static_req);
+    elem.form_matrix<double>(p.data(), &matl, &sect);
+    ref.form_matrix<double>(p.data(), &matl, &sect);
+    REQUIRE(0 == elem.get_mass().size());
+    REQUIRE(elem.get_stif() == ref.get_stif());
+    REQUIRE(elem.get_property() == ref.get_property());
+}
+
+TEST_CASE("block transform", "[EvalRequest]") {
+    matrix_<double> tran = matrix_<double>::Zero(6, 6), stif = matrix_<double>::Random(6, 6);
+    mat3_<double> rot;
+    rot << 0., 1., 0., -1., 0., 0., 0., 0., 1.;
+    tran.topLeftCorner<3, 3>() = tran.bottomRightCorner<3, 3>() = rot;
+    matrix_<double> empty, k(6, 6), m = matrix_<double>::Ones(6, 6);
+    vecX_<double> no_rhs, r = vecX_<double>::Ones(6);
+    for (auto pat: {TranPattern::IDENTITY, TranPattern::BLOCK_DIAGONAL, TranPattern::DENSE}) {
+        const matrix_<double> &t = TranPattern::IDENTITY == pat ? matrix_<double>::Identity(6, 6).eval(): tran;
+        BlockTran<double>::transform(t, pat, stif, empty, no_rhs, k, m, r);
+        REQUIRE(k.isApprox(t.transpose()*stif*t));
+        REQUIRE(m.isZero());
+        REQUIRE(r.isZero());
+    }
+}
@@ -0,0 +1,74 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+// Relative difference of matrices.
+double rel_diff(const matrix_<double> &a, const matrix_<double> &b) {
+    return (a-b).norm()/b.norm();
+}
+
+// Form element in both precisions and compare.
+template <class U>
+void require_close(ElementType et, std::vector<Node<U, double>> p, const Material<U> &matl,
+    const Section<U> &sect, double tol) {
+    Element<double> single(1, et, 1, 1, {1}), ref(1, et, 1, 1, {1});
+    single.set_single_precision(true);
+    REQUIRE(single.is_single_precision());
+    single.template form_matrix<U>(p.data(), &matl, &sect);
+    ref.template form_matrix<U>(p.data(), &matl, &sect);
+    REQUIRE(single.get_stif() != ref.get_stif());
+    REQUIRE(rel_diff(single.get_stif(), ref.get_stif()) < tol);
+    REQUIRE(rel_diff(single.get_mass(), ref.get_mass()) < tol);
+    REQUIRE(rel_diff(single.get_tran(), ref.get_tran()) < tol);
+    REQUIRE(single.get_tran_pattern() == ref.get_tran_pattern());
+    const auto &a = single.get_property(), &b = ref.get_property();
+    for (auto x: {ElementProp::LENGTH, ElementProp::VOLUME, ElementProp::MASS}) {
+        REQUIRE(a.has(x) == b.has(x));
+        REQUIRE(b.get(x) == Approx(a.get(x)).epsilon(tol));
+    }
+    // Global matrices are in double.
+    matrix_<double> k, m, k2, m2;
+    vecX_<double> r, r2;
+    single.get_global_matrix(k, m, r);
+    ref.get_global_matrix(k2, m2, r2);
+    REQUIRE(rel_diff(k, k2) < tol);
+    REQUIRE((r-r2).norm() <= tol*(1.0+r2.norm()));
+}
+}
+
+TEST_CASE("pipe", "[SinglePrecision]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    require_close(ElementType::PIPE16, p, matl, sect, 1.e-6);
+    require_close(ElementType::PIPE18, p, matl, sect, 1.e-5);
+}
+
+TEST_CASE("shell and solid", "[SinglePrecision]") {
+    Material<double> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3, 2.e11, 0., .3});
+    Section<double> shell(1, SectionType::SHELL, {.1});
+    std::vector<Node<double, double>> ps{{1, 0., 0., 0.}, {2, 2., .2, .1}, {3, 2.2, 1.9, .4}, {4, -.1, 2., .2},
+        {5, 1., 0., .2}, {6, 2.1, 1., .35}, {7, 1., 2., .5}, {8, 0., 1., .3}};
+    require_close(ElementType::S8R, ps, matl, shell, 1.e-5);
+
+    Section<double> solid(1, SectionType::SOLID, {0.});
+    std::vector<Node<double, double>> ph{{1, 0., 0., 0.}, {2, 1., 0., 0.}, {3, 1.1, 1., 0.}, {4, 0., 1., 0.},
+        {5, 0., 0., 1.}, {6, 1., 0., 1.2}, {7, 1., 1., 1.}, {8, 0., 1., 1.}};
+    require_close(ElementType::SOLID185, ph, matl, solid, 1.e-5);
+}
+
+TEST_CASE("property cast", "[SinglePrecision]") {
+    ElementProperty<double> a;
+    a.assign({{ElementProp::LENGTH, 2.}, {ElementProp::SIF, 1.5}});
+    auto b = a.cast<float>();
+    REQUIRE(b.has(ElementProp::LENGTH));
+    REQUIRE(!b.has(ElementProp::AREA));
+    REQUIRE(1.5f == b.get(ElementProp::SIF));
+    REQUIRE(a == b.cast<double>());
+}
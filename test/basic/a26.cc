@@ -0,0 +1,54 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/nodal_scatter.hpp"
+
+using namespace cafea;
+
+TEST_CASE("map", "[NodalScatter]") {
+    // Pipe line 10-20-30 and branch 20-40 with elbow center 50 not carrying result.
+    const std::vector<std::vector<int>> elem_node{{10, 20}, {20, 30}, {40, 20}, {}};
+    NodalScatter scatter;
+    scatter.init(elem_node);
+    REQUIRE(4 == scatter.get_num_elem());
+    REQUIRE(4 == scatter.get_num_node());
+    REQUIRE(1 == scatter.find(20));
+    REQUIRE(-1 == scatter.find(50));
+    REQUIRE(40 == scatter.get_node_id(3));
+    const auto i = static_cast<size_t>(scatter.find(20));
+    REQUIRE(3 == scatter.get_num_share(i));
+    // Shares keep order of elements.
+    const size_t elem[3] = {0, 1, 2};
+    const int pos[3] = {1, 0, 1};
+    for (size_t j = 0; j < 3; j++) {
+        REQUIRE(elem[j] == scatter.get_share(i, j).elem);
+        REQUIRE(pos[j] == scatter.get_share(i, j).pos);
+    }
+    scatter.clear();
+    REQUIRE(0 == scatter.get_num_node());
+}
+
+TEST_CASE("scatter", "[NodalScatter]") {
+    // Chain of elements, result of element e at local node j is 10*e+j.
+    const int ne{1000};
+    std::vector<std::vector<int>> elem_node;
+    for (int e = 0; e < ne; e++) elem_node.push_back({e+1, e+2});
+    NodalScatter scatter;
+    scatter.init(elem_node);
+    REQUIRE(static_cast<size_t>(ne+1) == scatter.get_num_node());
+
+    std::vector<std::vector<int>> result(ne);
+    NodalScatter::for_each(result.size(), [&] (size_t e) { result[e] = {10*int(e), 10*int(e)+1};});
+    // Last element wins, as serial overwrite.
+    std::vector<int> serial(ne+2, -1), nodal(ne+1, -1);
+    for (int e = 0; e < ne; e++) {
+        for (int j = 0; j < 2; j++) serial[elem_node[e][j]] = result[e][j];
+    }
+    scatter.for_each_node([&] (size_t i) {
+        const auto &s = scatter.get_share(i, scatter.get_num_share(i)-1);
+        nodal[i] = result[s.elem][s.pos];
+    });
+    for (size_t i = 0; i < nodal.size(); i++) REQUIRE(serial[scatter.get_node_id(i)] == nodal[i]);
+}
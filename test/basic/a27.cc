@@ -0,0 +1,61 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+// Post process of each frequency and part.
+cmatrix_<double> reference(const Element<double> &elem, const cmatrix_<double> &x, const cmatrix_<double> &rhs,
+    const cmatrix_<double> &load) {
+    cmatrix_<double> res(99, 2*x.cols());
+    for (int i = 0; i < x.cols(); i++) {
+        res.block(0, 2*i, 99, 2).real() = StructuralElementPost<double>::pipe(elem.get_stif(), elem.get_tran(),
+            x.col(i).real(), rhs.col(i).real(), elem.get_property(), true, load(0, i).real());
+        res.block(0, 2*i, 99, 2).imag() = StructuralElementPost<double>::pipe(elem.get_stif(), elem.get_tran(),
+            x.col(i).imag(), rhs.col(i).imag(), elem.get_property(), true, load(0, i).imag());
+    }
+    return res;
+}
+}
+
+TEST_CASE("batch of frequencies", "[PipeCmplx]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    for (auto et: {ElementType::PIPE16, ElementType::PIPE18}) {
+        Element<double> elem(1, et, 1, 1, {1});
+        elem.form_matrix<float>(p.data(), &matl, &sect);
+        const int n{40};
+        cmatrix_<double> x = 1.e-3*cmatrix_<double>::Random(12, n);
+        cmatrix_<double> rhs = 1.e3*cmatrix_<double>::Random(12, n);
+        cmatrix_<double> load = 1.e6*cmatrix_<double>::Random(1, n);
+        const auto ref = reference(elem, x, rhs, load);
+        const auto res = StructuralElementPost<double>::pipe_cmplx(elem.get_stif(), elem.get_tran(),
+            x, rhs, load, elem.get_property());
+        REQUIRE(99 == res.rows());
+        REQUIRE(2*n == res.cols());
+        for (int r = 0; r < 51; r++) {
+            REQUIRE((res.row(r)-ref.row(r)).norm() <= 1.e-10*(1.+ref.row(r).norm()));
+        }
+        REQUIRE(res.bottomRows(48).isZero());
+    }
+}
+
+TEST_CASE("pressure of attribute", "[PipeCmplx]") {
+    ElementProperty<double> attr;
+    attr.assign({{ElementProp::AW, .006}, {ElementProp::OD, .2}, {ElementProp::ID, .18},
+        {ElementProp::IY, 2.6e-5}, {ElementProp::SIF, 1.}, {ElementProp::PRESIN, 1.e6}});
+    matrix_<double> force = matrix_<double>::Random(12, 3);
+    const auto s = StructuralElementPost<double>::pipe_stress_batch(force, attr, vecX_<double>());
+    for (int i = 0; i < 3; i++) {
+        matrix_<double> esol = matrix_<double>::Zero(99, 2);
+        esol.block(0, 0, 6, 1) = force.block(0, i, 6, 1);
+        esol.block(0, 1, 6, 1) = force.block(6, i, 6, 1);
+        StructuralElementPost<double>::pipe_stress(esol, attr);
+        REQUIRE(s.middleCols(2*i, 2).isApprox(esol));
+    }
+}
@@ -0,0 +1,115 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+ElementProperty<double> pipe_attr() {
+    ElementProperty<double> attr;
+    attr.assign({{ElementProp::AW, .006}, {ElementProp::OD, .2}, {ElementProp::ID, .18},
+        {ElementProp::IY, 2.6e-5}, {ElementProp::SIF, 1.3}, {ElementProp::PRESIN, 1.e6}});
+    return attr;
+}
+}
+
+TEST_CASE("layout", "[ResultRequest]") {
+    ResultRequest full;
+    REQUIRE(full.is_full());
+    REQUIRE(99 == full.get_num_row());
+    REQUIRE(3 == full.get_row(PipeResult::FORCE, 3));
+    REQUIRE(7 == full.get_row(PipeResult::SBEND));
+    REQUIRE(11 == full.get_row(PipeResult::SAXL, 0));
+    REQUIRE(45 == full.get_row(PipeResult::SEQV, 2));
+    REQUIRE(-1 == full.get_envelope_row(PipeResult::SEQV));
+
+    ResultRequest req(PipeResult::SBEND | PipeResult::SEQV, 0x11u, PipeResult::SEQV | PipeResult::S2);
+    REQUIRE(!req.is_full());
+    REQUIRE(5 == req.get_num_row());
+    REQUIRE(-1 == req.get_row(PipeResult::FORCE, 0));
+    REQUIRE(0 == req.get_row(PipeResult::SBEND));
+    REQUIRE(1 == req.get_row(PipeResult::SEQV, 0));
+    REQUIRE(-1 == req.get_row(PipeResult::SEQV, 1));
+    REQUIRE(2 == req.get_row(PipeResult::SEQV, 4));
+    REQUIRE(3 == req.get_envelope_row(PipeResult::S2));
+    REQUIRE(4 == req.get_envelope_row(PipeResult::SEQV));
+    // Dependencies are evaluated but not stored.
+    REQUIRE(req.need(PipeResult::SAXL));
+    REQUIRE(req.need(PipeResult::SSF));
+    REQUIRE(-1 == req.get_row(PipeResult::SH));
+    REQUIRE(!ResultRequest(PipeResult::SBEND).need(PipeResult::SDIR));
+}
+
+TEST_CASE("selected rows", "[ResultRequest]") {
+    const auto attr = pipe_attr();
+    matrix_<double> force = 1.e3*matrix_<double>::Random(12, 37);
+    vecX_<double> pres = 1.e6*vecX_<double>::Random(37);
+    const auto ref = StructuralElementPost<double>::pipe_stress_batch(force, attr, pres);
+    REQUIRE(99 == ref.rows());
+    REQUIRE(ref.bottomRows(48).isZero());
+
+    const auto env = PipeResult::SAXL | PipeResult::SXH | PipeResult::S1 | PipeResult::S2 | PipeResult::SEQV;
+    ResultRequest req(PipeResult::FORCE | PipeResult::SH | PipeResult::S1 | PipeResult::SEQV, 0xA5u, env);
+    const auto res = StructuralElementPost<double>::pipe_stress_batch(force, attr, pres, req);
+    REQUIRE(req.get_num_row() == res.rows());
+    REQUIRE(ref.cols() == res.cols());
+    for (int j = 0; j < 6; j++) REQUIRE(res.row(req.get_row(PipeResult::FORCE, j)) == ref.row(j));
+    REQUIRE(res.row(req.get_row(PipeResult::SH)).isApprox(ref.row(9)));
+    for (int j = 0; j < 8; j++) {
+        const int r = req.get_row(PipeResult::SEQV, j);
+        REQUIRE((0 <= r) == (0 != (0xA5 & (1 << j))));
+        if (0 <= r) REQUIRE(res.row(r).isApprox(ref.row(43+j)));
+        if (0 <= r) REQUIRE(res.row(req.get_row(PipeResult::S1, j)).isApprox(ref.row(27+j)));
+    }
+    // Envelopes over selected points.
+    const int pts[4] = {0, 2, 5, 7};
+    for (int c = 0; c < res.cols(); c++) {
+        double seqv = ref(43, c), s2 = ref(35, c), saxl = ref(11, c);
+        for (int j: pts) {
+            seqv = std::max(seqv, ref(43+j, c));
+            s2 = std::min(s2, ref(35+j, c));
+            saxl = std::max(saxl, ref(11+j, c));
+        }
+        REQUIRE(seqv == Approx(res(req.get_envelope_row(PipeResult::SEQV), c)));
+        REQUIRE(s2 == Approx(res(req.get_envelope_row(PipeResult::S2), c)));
+        REQUIRE(saxl == Approx(res(req.get_envelope_row(PipeResult::SAXL), c)));
+    }
+}
+
+TEST_CASE("element", "[ResultRequest]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    ResultRequest req(PipeResult::SBEND | PipeResult::SEQV, 0x03u, PipeResult::SEQV);
+    for (auto et: {ElementType::PIPE16, ElementType::PIPE18}) {
+        Element<double> elem(1, et, 1, 1, {1}), ref(1, et, 1, 1, {1});
+        elem.form_matrix<float>(p.data(), &matl, &sect);
+        ref.form_matrix<float>(p.data(), &matl, &sect);
+        elem.set_result_request(req);
+        REQUIRE(!elem.get_result_request().is_full());
+        vecX_<double> x = 1.e-3*vecX_<double>::Random(12);
+        elem.post_stress(x);
+        ref.post_stress(x);
+        const auto res = elem.get_result(), full = ref.get_result();
+        REQUIRE(4 == res.rows());
+        REQUIRE(2 == res.cols());
+        REQUIRE(res.row(0).isApprox(full.row(7)));
+        REQUIRE(res.row(1).isApprox(full.row(43)));
+        REQUIRE(res.row(2).isApprox(full.row(44)));
+        for (int c = 0; c < 2; c++) REQUIRE(full.col(c).segment(43, 2).maxCoeff() == Approx(res(3, c)));
+        // Complex result keeps only requested rows.
+        const int n{5};
+        cmatrix_<double> xc = 1.e-3*cmatrix_<double>::Random(12, n), rhs = cmatrix_<double>::Zero(12, n);
+        cmatrix_<double> load = 1.e6*cmatrix_<double>::Random(1, n);
+        const auto a = StructuralElementPost<double>::pipe_cmplx(elem.get_stif(), elem.get_tran(), xc, rhs, load,
+            elem.get_property(), req);
+        const auto b = StructuralElementPost<double>::pipe_cmplx(elem.get_stif(), elem.get_tran(), xc, rhs, load,
+            elem.get_property());
+        REQUIRE(4 == a.rows());
+        REQUIRE(a.row(0).isApprox(b.row(7)));
+        REQUIRE(a.row(1).isApprox(b.row(43)));
+    }
+}
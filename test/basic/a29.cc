@@ -0,0 +1,95 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/envelope.hpp"
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+TEST_CASE("update in blocks", "[Envelope]") {
+    Envelope<double> env;
+    env.init({10, 20, 30}, 4);
+    REQUIRE(3 == env.get_num_item());
+    REQUIRE(4 == env.get_num_row());
+    REQUIRE(1 == env.find(20));
+    REQUIRE(-1 == env.find(40));
+    REQUIRE(30 == env.get_id(2));
+    REQUIRE((-1 == env.get_max_step().array()).all());
+
+    const int n{50};
+    matrix_<double> hist = matrix_<double>::Random(4, n);
+    hist(2, 7) = hist(2, 31) = 5.;
+    // Steps come in blocks of different size.
+    for (int k = 0, w = 1; k < n; k += w, w = w%7+1) {
+        const int m = std::min(w, n-k);
+        env.update(1, k, hist.middleCols(k, m));
+    }
+    for (int r = 0; r < 4; r++) {
+        Eigen::Index a, b;
+        REQUIRE(hist.row(r).maxCoeff(&a) == env.get_max()(r, 1));
+        REQUIRE(hist.row(r).minCoeff(&b) == env.get_min()(r, 1));
+        REQUIRE(a == env.get_max_step()(r, 1));
+        REQUIRE(b == env.get_min_step()(r, 1));
+    }
+    // Ties keep the earlier step.
+    REQUIRE(7 == env.get_max_step()(2, 1));
+    // Items not updated are untouched.
+    REQUIRE((-1 == env.get_max_step().col(0).array()).all());
+    // Fewer rows only update leading rows.
+    env.update(2, 3, matrix_<double>::Constant(2, 1, 1.));
+    REQUIRE(3 == env.get_max_step()(1, 2));
+    REQUIRE(-1 == env.get_max_step()(2, 2));
+}
+
+TEST_CASE("merge and complex", "[Envelope]") {
+    const int n{30};
+    cmatrix_<double> hist = cmatrix_<double>::Random(3, n);
+    Envelope<double> all, lo, hi;
+    for (auto p: {&all, &lo, &hi}) p->init({1, 2}, 3);
+    all.update(0, 0, hist);
+    lo.update(0, 0, hist.leftCols(12));
+    hi.update(0, 12, hist.rightCols(n-12));
+    hi.merge(lo);
+    REQUIRE(all.get_max() == hi.get_max());
+    REQUIRE(all.get_min() == hi.get_min());
+    REQUIRE(all.get_max_step() == hi.get_max_step());
+    REQUIRE(all.get_min_step() == hi.get_min_step());
+    matrix_<double> amp = hist.cwiseAbs();
+    for (int r = 0; r < 3; r++) {
+        Eigen::Index a;
+        REQUIRE(amp.row(r).maxCoeff(&a) == all.get_max()(r, 0));
+        REQUIRE(a == all.get_max_step()(r, 0));
+    }
+}
+
+TEST_CASE("pipe stress of frequencies", "[Envelope]") {
+    REQUIRE(ElementAttr::has_stress(ElementType::PIPE16));
+    REQUIRE(!ElementAttr::has_stress(ElementType::MASS21));
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    Element<double> elem(1, ElementType::PIPE16, 1, 1, {1});
+    elem.form_matrix<float>(p.data(), &matl, &sect);
+    const int n{20};
+    cmatrix_<double> x = 1.e-3*cmatrix_<double>::Random(12, n);
+    cmatrix_<double> rhs = cmatrix_<double>::Zero(12, n), load = cmatrix_<double>::Zero(1, n);
+    ResultRequest req(PipeResult::SEQV | PipeResult::SBEND);
+    const auto res = StructuralElementPost<double>::pipe_cmplx(elem.get_stif(), elem.get_tran(),
+        x, rhs, load, elem.get_property(), req);
+    const auto m = res.rows();
+    Envelope<double> env, node;
+    env.init({1}, 2*m);
+    node.init({2}, m);
+    env.update(0, 0, Eigen::Map<const cmatrix_<double>>(res.data(), 2*m, n));
+    node.update(0, 0, Eigen::Map<const cmatrix_<double>, 0, Eigen::OuterStride<>>(res.data()+m, m, n,
+        Eigen::OuterStride<>(2*m)));
+    const int r = req.get_row(PipeResult::SEQV, 3);
+    Eigen::Index a;
+    const double peak = res.row(r)(Eigen::seq(1, Eigen::last, 2)).cwiseAbs().maxCoeff(&a);
+    REQUIRE(peak == node.get_max()(r, 0));
+    REQUIRE(a == node.get_max_step()(r, 0));
+    REQUIRE(peak == env.get_max()(m+r, 0));
+    REQUIRE(res.row(r)(Eigen::seq(0, Eigen::last, 2)).cwiseAbs().maxCoeff() == env.get_max()(r, 0));
+}
@@ -0,0 +1,80 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/load_combination.hpp"
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+TEST_CASE("rules", "[LoadCombination]") {
+    LoadCombination<double> comb;
+    comb.init(3);
+    // Sustained, seismic envelope and their sum.
+    REQUIRE(0 == comb.add(CombinationRule::LINEAR, {{0, 1.}, {1, 1.}}));
+    REQUIRE(1 == comb.add(CombinationRule::SRSS, {{1, 1.}, {2, 2.}}));
+    REQUIRE(2 == comb.add(CombinationRule::ABS, {{3, 1.}, {4, 1.}}));
+    REQUIRE(3 == comb.add(CombinationRule::MAX, {{2, 1.}, {2, -1.}}));
+    REQUIRE(4 == comb.add(CombinationRule::MIN, {{0, 1.}, {1, -1.}, {2, 1.}}));
+    REQUIRE(3 == comb.get_num_case());
+    REQUIRE(5 == comb.get_num_combination());
+
+    const int m{1000};
+    matrix_<double> u = matrix_<double>::Random(m, 3);
+    const auto res = comb.combine(u);
+    REQUIRE(m == res.rows());
+    REQUIRE(5 == res.cols());
+    for (int i = 0; i < m; i++) {
+        const double a = u(i, 0), b = u(i, 1), c = u(i, 2);
+        const double srss = std::sqrt(b*b+4.*c*c);
+        REQUIRE(Approx(a+b) == res(i, 0));
+        REQUIRE(Approx(srss) == res(i, 1));
+        REQUIRE(Approx(std::abs(a+b)+srss) == res(i, 2));
+        REQUIRE(std::abs(c) == res(i, 3));
+        REQUIRE(std::min({a, -b, c}) == res(i, 4));
+    }
+}
+
+TEST_CASE("pipe", "[LoadCombination]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    for (auto et: {ElementType::PIPE16, ElementType::PIPE18}) {
+        Element<double> elem(1, et, 1, 1, {1});
+        elem.form_matrix<float>(p.data(), &matl, &sect);
+        const auto &attr = elem.get_property();
+        matrix_<double> x = 1.e-4*matrix_<double>::Random(12, 3);
+        matrix_<double> rhs = 1.e2*matrix_<double>::Random(12, 3);
+        vecX_<double> pres(3);
+        pres << 1.e6, 0., 2.e5;
+        LoadCombination<double> comb;
+        comb.init(3);
+        comb.add(CombinationRule::LINEAR, {{0, 1.}, {2, -.5}});
+        comb.add(CombinationRule::SRSS, {{0, 1.}, {1, 1.}});
+        const auto res = StructuralElementPost<double>::pipe_combine(elem.get_stif(), elem.get_tran(),
+            x, rhs, pres, attr, comb);
+        REQUIRE(99 == res.rows());
+        REQUIRE(4 == res.cols());
+        // Linear combination is the result of combined load.
+        const auto lin = StructuralElementPost<double>::pipe(elem.get_stif(), elem.get_tran(),
+            x.col(0)-.5*x.col(2), rhs.col(0)-.5*rhs.col(2), attr, true, pres(0)-.5*pres(2));
+        REQUIRE((res.leftCols(2)-lin).norm() <= 1.e-9*lin.norm());
+        // Other rules act on results of terms.
+        matrix_<double> a = StructuralElementPost<double>::pipe(elem.get_stif(), elem.get_tran(),
+            x.col(0), rhs.col(0), attr, true, pres(0));
+        matrix_<double> b = StructuralElementPost<double>::pipe(elem.get_stif(), elem.get_tran(),
+            x.col(1), rhs.col(1), attr, true, pres(1));
+        matrix_<double> srss = (a.array().square()+b.array().square()).sqrt().matrix();
+        REQUIRE((res.rightCols(2)-srss).norm() <= 1.e-9*srss.norm());
+
+        // Stored rows only.
+        ResultRequest req(PipeResult::SEQV | PipeResult::SBEND, 0x11u);
+        const auto part = StructuralElementPost<double>::pipe_combine(elem.get_stif(), elem.get_tran(),
+            x, rhs, pres, attr, comb, req);
+        REQUIRE(req.get_num_row() == part.rows());
+        const int r = req.get_row(PipeResult::SEQV, 4), rf = ResultRequest().get_row(PipeResult::SEQV, 4);
+        REQUIRE(Approx(lin(rf, 0)) == part(r, 0));
+        REQUIRE(Approx(srss(rf, 1)) == part(r, 3));
+    }
+}
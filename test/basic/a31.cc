@@ -0,0 +1,98 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "cafea/element/code_check.hpp"
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+// Attribute of pipe with outer diameter, thickness and SIF.
+ElementProperty<double> pipe_attr(double od, double t, double sif, double pres) {
+    const double id = od-2.*t, iy = M_PI/64.*(std::pow(od, 4)-std::pow(id, 4));
+    ElementProperty<double> attr;
+    attr.assign({{ElementProp::OD, od}, {ElementProp::ID, id}, {ElementProp::THICK, t}, {ElementProp::IY, iy},
+        {ElementProp::SIF, sif}, {ElementProp::PRESIN, pres}});
+    return attr;
+}
+}
+
+TEST_CASE("equations", "[PipeCodeCheck]") {
+    PipeCodeCheck<double> chk;
+    chk.reserve(2);
+    chk.add(11, pipe_attr(.2, .01, 1., 2.e6), 1.e8, 1.2e8);
+    chk.add(12, pipe_attr(.3, .02, 2., 0.), 1.e8, 1.2e8);
+    chk.set_factor(1., 1.2);
+    REQUIRE(0 == chk.add_check(PipeCodeCase::SUSTAINED, 0));
+    REQUIRE(1 == chk.add_check(PipeCodeCase::OCCASIONAL, 1, 0));
+    REQUIRE(2 == chk.add_check(PipeCodeCase::EXPANSION, 2));
+    REQUIRE(3 == chk.add_check(PipeCodeCase::EXPANSION, 2, 0));
+    chk.init_moment(3);
+    // Member force of 3 combinations, moment of node J is larger.
+    matrix_<double> f = matrix_<double>::Zero(6, 6);
+    for (int c = 0; c < 3; c++) {
+        f(3, 2*c) = 1.e3*(c+1);
+        f.block(3, 2*c+1, 3, 1) << 3.e3*(c+1), 4.e3*(c+1), 0.;
+    }
+    chk.set_moment(0, f);
+    chk.set_moment(1, 10.*f);
+    REQUIRE(5.e3 == chk.get_moment()(0, 0));
+    REQUIRE(1.5e5 == chk.get_moment()(1, 2));
+    chk.evaluate();
+
+    const auto &s = chk.get_stress();
+    const auto &a = chk.get_allowable();
+    const double z0 = 2.*pipe_attr(.2, .01, 1., 0.).get(ElementProp::IY)/.2;
+    const double z1 = 2.*pipe_attr(.3, .02, 2., 0.).get(ElementProp::IY)/.3;
+    const double pl = 2.e6*.2/(4.*.01), sl = pl+5.e3/z0;
+    REQUIRE(Approx(sl) == s(0, 0));
+    REQUIRE(Approx(1.5*5.e4/z1) == s(1, 0));
+    REQUIRE(Approx(pl+(5.e3+1.e4)/z0) == s(0, 1));
+    REQUIRE(Approx(1.2e8) == a(0, 1));
+    REQUIRE(Approx(1.5e4/z0) == s(0, 2));
+    REQUIRE(Approx(2.*1.5e5/z1) == s(1, 2));
+    REQUIRE(Approx(1.25*1.2e8+.25e8) == a(0, 2));
+    REQUIRE(Approx(1.25*1.2e8+.25e8+1.e8-sl) == a(0, 3));
+    REQUIRE(chk.get_ratio().isApprox((s.array()/a.array()).matrix()));
+
+    // Heavy moment fails the second element only.
+    REQUIRE(chk.is_pass(0));
+    REQUIRE(!chk.is_pass(1));
+    REQUIRE(0 == chk.get_num_fail(0));
+    REQUIRE(1 == chk.get_num_fail(2));
+    size_t k{0};
+    REQUIRE(chk.get_max_ratio(2, &k) > 1.);
+    REQUIRE(1 == k);
+    chk.print_summary();
+}
+
+TEST_CASE("combinations of pipe", "[PipeCodeCheck]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 1.f, 0.f}, {3, 0.f, 1.f, 0.f}};
+    Element<double> elem(1, ElementType::PIPE18, 1, 1, {1});
+    elem.form_matrix<float>(p.data(), &matl, &sect);
+    matrix_<double> x = 1.e-4*matrix_<double>::Random(12, 2), rhs = matrix_<double>::Zero(12, 2);
+    LoadCombination<double> comb;
+    comb.init(2);
+    comb.add(CombinationRule::LINEAR, {{0, 1.}});
+    comb.add(CombinationRule::ABS, {{1, 1.}});
+    const auto force = StructuralElementPost<double>::pipe_combine(elem.get_stif(), elem.get_tran(), x, rhs,
+        vecX_<double>(), elem.get_property(), comb, ResultRequest(PipeResult::FORCE));
+    PipeCodeCheck<double> chk;
+    chk.add(1, elem.get_property(), 1.e8, 1.e8);
+    chk.add_check(PipeCodeCase::SUSTAINED, 0);
+    chk.init_moment(2);
+    chk.set_moment(0, force);
+    chk.evaluate();
+    // Same as longitudinal stress of code with moment of the larger end.
+    const auto &attr = elem.get_property();
+    const double z = 2.*attr.get(ElementProp::IY)/attr.get(ElementProp::OD);
+    const double m = force.middleRows(3, 3).leftCols(2).colwise().norm().maxCoeff();
+    const double i75 = std::max(1., .75*attr.get(ElementProp::SIF));
+    REQUIRE(Approx(attr.get(ElementProp::PRESIN)*attr.get(ElementProp::OD)/(4.*attr.get(ElementProp::THICK))+i75*m/z)
+        == chk.get_stress()(0, 0));
+}
@@ -0,0 +1,56 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/node.hpp"
+#include "cafea/base/dof_table.hpp"
+
+using namespace cafea;
+
+TEST_CASE("table", "[DofTable]") {
+    DofTable table;
+    table.reserve(3, 14);
+    REQUIRE(0 == table.add(7, {0, 1, 2, -11, -11, -11}));
+    REQUIRE(1 == table.add(3, {}));
+    REQUIRE(2 == table.add(5, {3, 4, 5, 6, 7, 8, -12, 9}));
+    REQUIRE(2 == table.add(5, {}));
+    REQUIRE(3 == table.get_num_node());
+    REQUIRE(10 == table.get_dim());
+    REQUIRE(2 == table.find(5));
+    REQUIRE(-1 == table.find(4));
+    REQUIRE(3 == table.get_node_id(1));
+    REQUIRE(0 == table.get_num_dofs(1));
+    REQUIRE(8 == table.get_num_dofs(2));
+    REQUIRE(9 == table.get_dofs(2)[7]);
+    REQUIRE(table.get_dofs(0)+6 == table.get_dofs(2));
+    REQUIRE(2 == table.get_dof(0, 2));
+    REQUIRE(0 > table.get_dof(0, 6));
+    REQUIRE(7 == table.get_dof_by_id(5, 4));
+    REQUIRE(0 > table.get_dof_by_id(4, 0));
+    REQUIRE(DofType::NORMAL == table.get_constraint(2, 0));
+    REQUIRE(DofType::ELIMINATE == table.get_constraint(0, 3));
+    REQUIRE(DofType::CONSTRAINT == table.get_constraint(2, 6));
+    table.clear();
+    REQUIRE(0 == table.get_num_node());
+    REQUIRE(0 == table.get_dim());
+}
+
+TEST_CASE("dofs of node", "[DofTable]") {
+    Node<float, double> a{1, 0.f, 0.f, 0.f};
+    a.dof_init(ElementType::PIPE16);
+    a.dof_apply(Boundary<float>(1, BoundaryType::FIXED, DofLabel::U_ALL));
+    int num{4};
+    a.dof_accum(&num, DofType::NORMAL);
+    REQUIRE(7 == num);
+    const std::vector<int> ref{-11, -11, -11, 4, 5, 6};
+    REQUIRE(ref == a.dof_list());
+    // Copy keeps its own dofs.
+    Node<float, double> b = a;
+    a.dof_apply(Boundary<float>(1, BoundaryType::FIXED, DofLabel::ALL));
+    REQUIRE(ref == b.dof_list());
+    REQUIRE(-11 == a.dof_list()[5]);
+    DofTable table;
+    table.add(a.get_id(), b.dof_list());
+    REQUIRE(7 == table.get_dim());
+}
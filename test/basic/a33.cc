@@ -0,0 +1,72 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/dense_dict.hpp"
+
+using namespace cafea;
+
+namespace {
+// Element stub for connectivity.
+struct Cell {
+    std::vector<int> nodes;
+    int matl, sect;
+    const std::vector<int>& get_node_list() const { return nodes;}
+    int get_material_id() const { return matl;}
+    int get_section_id() const { return sect;}
+};
+}
+
+TEST_CASE("dense dict", "[DenseDict]") {
+    DenseDict<double> a;
+    REQUIRE(a.empty());
+    REQUIRE(a.emplace(30, 3.).second);
+    REQUIRE(a.emplace(10, 1.).second);
+    REQUIRE(a.emplace(20, 2.).second);
+    auto got = a.emplace(10, 5.);
+    REQUIRE(!got.second);
+    REQUIRE(1. == got.first->second);
+    REQUIRE(3 == a.size());
+    // Order of insertion.
+    std::vector<int> id;
+    for (const auto &it: a) id.push_back(it.first);
+    REQUIRE(id == std::vector<int>{30, 10, 20});
+    REQUIRE(1 == a.index(10));
+    REQUIRE(-1 == a.index(40));
+    REQUIRE(a.find(40) == a.end());
+    REQUIRE(2. == a.find(20)->second);
+    a.at(20) = 4.;
+    REQUIRE(4. == a.value(2));
+    REQUIRE(30 == a.get_id(0));
+    a.clear();
+    REQUIRE(a.empty());
+    REQUIRE(-1 == a.index(30));
+}
+
+TEST_CASE("connectivity", "[DenseDict]") {
+    DenseDict<int> node, matl, sect;
+    for (int i: {5, 3, 1, 7}) node.emplace(i, i);
+    matl.emplace(1, 0);
+    sect.emplace(2, 0);
+    sect.emplace(1, 0);
+    DenseDict<Cell> elem;
+    elem.emplace(1, Cell{{1, 3}, 1, 1});
+    elem.emplace(2, Cell{{3, 9, 7}, 2, 2});
+    Connectivity conn;
+    conn.init(elem, node, matl, sect);
+    REQUIRE(2 == conn.get_num_elem());
+    REQUIRE(2 == conn.get_num_node(0));
+    REQUIRE(3 == conn.get_num_node(1));
+    REQUIRE(2 == conn.get_node(0)[0]);
+    REQUIRE(1 == conn.get_node(0)[1]);
+    REQUIRE(1 == conn.get_node(1)[0]);
+    REQUIRE(-1 == conn.get_node(1)[1]);
+    REQUIRE(3 == conn.get_node(1)[2]);
+    REQUIRE(0 == conn.get_material(0));
+    REQUIRE(-1 == conn.get_material(1));
+    REQUIRE(1 == conn.get_section(0));
+    REQUIRE(0 == conn.get_section(1));
+    conn.clear();
+    REQUIRE(0 == conn.get_num_elem());
+}
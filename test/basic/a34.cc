@@ -0,0 +1,70 @@
+#define CATCH_CONFIG_MAIN
+#define CAFEA_ALLOC_COUNTER_IMPL
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/element/element.hpp"
+#include "cafea/utils/alloc_counter.hpp"
+
+using namespace cafea;
+
+namespace {
+// Form element and read global matrices in fixed size.
+template <int N>
+void form(Element<double> &elem, const NodeBase<float>* const pt[], const Material<float> &matl,
+    const Section<float> &sect, double &sum) {
+    elem.form_matrix<float>(pt, &matl, &sect);
+    matN_<double, N> k, m;
+    vecN_<double, N> r;
+    elem.get_global_matrix(k, m, r);
+    sum += k.trace()+m.trace();
+}
+}
+
+TEST_CASE("counter", "[AllocCounter]") {
+    std::vector<matrix_<double>> keep;
+    AllocCounter c;
+    keep.emplace_back(matrix_<double>::Zero(8, 8));
+    const auto num = c.count();
+    REQUIRE(0 < num);
+    REQUIRE(8 == keep.back().rows());
+    c.reset();
+    REQUIRE(0 == c.count());
+}
+
+TEST_CASE("node view", "[AllocCounter]") {
+    Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+    Section<float> pipe(1, SectionType::PIPE, {.2f, .01f, 1.f, 0.f, 1.e6f});
+    Section<float> solid(2, SectionType::SOLID, {0.f});
+    std::vector<Node<float, double>> p{{1, 0.f, 0.f, 0.f}, {2, 1.f, 0.f, 0.f}, {3, 1.1f, 1.f, 0.f},
+        {4, 0.f, 1.f, 0.f}, {5, 0.f, 0.f, 1.f}, {6, 1.f, 0.f, 1.2f}, {7, 1.f, 1.f, 1.f}, {8, 0.f, 1.f, 1.f}};
+    const NodeBase<float> *pt[8];
+    for (size_t i = 0; i < 8; i++) pt[i] = &p[i];
+    std::vector<Element<double>> elem{{1, ElementType::PIPE16, 1, 1, {1, 2}},
+        {2, ElementType::PIPE18, 1, 1, {2, 3, 4}}, {3, ElementType::SOLID185, 1, 2, {1, 2, 3, 4, 5, 6, 7, 8}},
+        {4, ElementType::PIPE16, 1, 1, {1, 2}}};
+    elem[3].set_single_precision(true);
+    // Same matrices as array of nodes.
+    Element<double> ref(1, ElementType::PIPE18, 1, 1, {2, 3, 4});
+    ref.form_matrix<float>(&p[1], &matl, &pipe);
+    elem[1].form_matrix<float>(&pt[1], &matl, &pipe);
+    REQUIRE(ref.get_stif() == elem[1].get_stif());
+    REQUIRE(ref.get_mass() == elem[1].get_mass());
+    REQUIRE(ref.get_tran() == elem[1].get_tran());
+
+    double sum[2] = {0., 0.};
+    size_t num[2];
+    for (int s: {0, 1}) {
+        AllocCounter c;
+        form<12>(elem[0], pt, matl, pipe, sum[s]);
+        form<12>(elem[1], &pt[1], matl, pipe, sum[s]);
+        form<24>(elem[2], pt, matl, solid, sum[s]);
+        form<12>(elem[3], pt, matl, pipe, sum[s]);
+        num[s] = c.count();
+    }
+    // Storage of element matrices is kept after the first pass.
+    REQUIRE(0 < num[0]);
+    REQUIRE(0 == num[1]);
+    REQUIRE(sum[0] == sum[1]);
+}
@@ -0,0 +1,62 @@
+#define CATCH_CONFIG_MAIN
+#define CAFEA_ALLOC_COUNTER_IMPL
+#include "catch.hpp"
+
+#include <vector>
+
+#include "cafea/base/node.hpp"
+#include "cafea/element/element.hpp"
+#include "cafea/utils/alloc_counter.hpp"
+
+using namespace cafea;
+
+TEST_CASE("compact", "[ObjectBase]") {
+    REQUIRE(sizeof(ObjectBase) <= 3*sizeof(void*));
+    ObjectBase a(7, "Node");
+    REQUIRE(a.get_name() == "Node#7");
+    a.set_id(8);
+    REQUIRE(a.get_name() == "Node#8");
+    a.set_name("Pump", true, '-');
+    REQUIRE(a.get_name() == "Pump-8");
+    a.set_name("Valve");
+    REQUIRE(a.get_name() == "Valve");
+    ObjectBase b(3, std::string("Elem"), '_');
+    REQUIRE(b.get_name() == "Elem_3");
+    // Strings are interned once.
+    const auto num = StringPool::size();
+    ObjectBase c(4, "Elem");
+    REQUIRE(num == StringPool::size());
+    REQUIRE(StringPool::intern("Elem") == StringPool::intern(std::string("Elem")));
+}
+
+TEST_CASE("side table", "[ObjectBase]") {
+    ObjectTable::clear();
+    Node<float, double> p(5, 0.f, 1.f, 2.f);
+    Element<double> e(5, ElementType::PIPE16, 1, 1, {1, 2});
+    REQUIRE(0 == ObjectTable::size());
+    REQUIRE(e.get_tag_by_index(0).empty());
+    p.set_tags("inlet", 2.5);
+    p.set_group({4, 9});
+    REQUIRE(1 == ObjectTable::size());
+    // Copies share attributes, other kinds with same id do not.
+    auto q = p;
+    REQUIRE(q.get_tag_by_index(0) == "inlet");
+    REQUIRE(q.get_tag_by_index(1) == "2.5");
+    REQUIRE(9 == q.get_group()[1]);
+    REQUIRE(e.get_tag_by_index(0).empty());
+    REQUIRE(0 == e.get_group()[0]);
+    ObjectTable::clear();
+    REQUIRE(p.get_tag_by_index(0).empty());
+}
+
+TEST_CASE("construction", "[ObjectBase]") {
+    std::vector<Node<float, double>> node;
+    node.reserve(1000);
+    // Kind of node is added to pool by the first one.
+    node.emplace_back(1, 1.f, 0.f, 0.f);
+    AllocCounter c;
+    for (int i = 2; i <= 1000; i++) node.emplace_back(i, float(i), 0.f, 0.f);
+    const auto num = c.count();
+    REQUIRE(0 == num);
+    REQUIRE(node.back().get_name() == "Node#1000");
+}
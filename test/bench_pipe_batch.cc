@@ -0,0 +1,73 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <cstdlib>
+#include <vector>
+
+#include "fmt/format.h"
+
+#include "cafea/utils/timer.hpp"
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+/**
+ *  \brief Microbenchmark of batched and per-element PIPE16 kernels.
+ *
+ *  Usage: bench_pipe_batch [number of elements] [repeats]
+ */
+int main(int argc, char **argv) {
+	const size_t num = 1 < argc ? std::strtoul(argv[1], nullptr, 10): 100000;
+	const int rep = 2 < argc ? std::atoi(argv[2]): 5;
+	Material<float> matl(1, MaterialType::LINEAR_ELASTIC, {7.8e3f, 2.0e11f, 0.f, .3f});
+	// Without fluid, per-element kernel prints fluid mass of each element.
+	Section<float> sect(1, SectionType::PIPE, {.2f, .01f, 0.f, 0.f, 1.e6f});
+	std::vector<Node<float, double>> pt;
+	pt.reserve(num+1);
+	for (size_t i = 0; i <= num; i++) {
+		float s = static_cast<float>(i);
+		pt.emplace_back(static_cast<int>(i+1), s, 0.5f*s + 0.1f*(i%7), 0.25f*(i%3));
+	}
+	const int opt[10] = {0};
+	elem_kernel_<double, ElementType::PIPE16> ke;
+	ElementProperty<double> attr;
+	double chk[2] = {0., 0.};
+
+	Timer t0;
+	for (int r = 0; r < rep; r++) {
+		for (size_t i = 0; i < num; i++) {
+			StructuralElement<float, double>::pipe16(&pt[i], &pt[i+1], &matl, &sect, opt, ke, attr);
+			chk[0] += ke.stif(1, 1);
+		}
+	}
+	const double dt0 = t0.elapsed();
+
+	PipeBatch<float, double> batch;
+	double dt[3] = {0., 0., 0.};
+	for (int r = 0; r < rep; r++) {
+		Timer t1;
+		batch.clear();
+		batch.reserve(num);
+		for (size_t i = 0; i < num; i++) batch.add(&pt[i], &pt[i+1], &matl, &sect, opt);
+		dt[0] += t1.elapsed();
+		t1.reset();
+		batch.evaluate();
+		dt[1] += t1.elapsed();
+		t1.reset();
+		for (size_t i = 0; i < num; i++) {
+			batch.get_kernel(i, ke, attr);
+			chk[1] += ke.stif(1, 1);
+		}
+		dt[2] += t1.elapsed();
+	}
+	const double dt1 = dt[0] + dt[1] + dt[2];
+
+	fmt::print("Elements: {}\tRepeats: {}\n", num, rep);
+	fmt::print("Per element: {:8.4f} s\tBatched: {:8.4f} s\tSpeedup: {:5.2f}\n", dt0, dt1, dt0/dt1);
+	fmt::print("Batched gather: {:8.4f} s\tevaluate: {:8.4f} s\tscatter: {:8.4f} s\n", dt[0], dt[1], dt[2]);
+	fmt::print("Checksum difference: {:g}\n", (chk[1]-chk[0])/chk[0]);
+	return 0;
+}
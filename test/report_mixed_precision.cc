@@ -0,0 +1,254 @@
+/*
+ *  cafea --- A FEA library for dynamic analysis.
+ *  Copyright (c) 2007-2017 T.Q.
+ *  All rights reserved.
+ *  Distributed under GPL v3 license.
+ */
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "cafea/utils/timer.hpp"
+#include "cafea/element/element.hpp"
+
+using namespace cafea;
+
+namespace {
+/**
+ *  \brief Pipe model of Ansys CDB file.
+ *
+ *  Only element types, real constants, nodes, elements and isotropic
+ *  materials are read, which is enough to form PIPE16 and PIPE18.
+ */
+struct CdbModel {
+	//! Element of CDB file.
+	struct Cell {
+		int id, mat, type, real;//!< Element id, material, type and real constant set.
+		std::vector<int> nodes;//!< Node list.
+	};
+	std::map<int, int> etype;//!< Ansys element number of type.
+	std::map<int, std::vector<double>> rconst;//!< Real constant sets.
+	std::map<int, std::array<double, 3>> matl;//!< Density, Young's modulus and Poisson's ratio.
+	std::map<int, std::array<double, 3>> xyz;//!< Coordinates of nodes.
+	std::vector<Cell> elem;//!< Elements.
+};
+//! Field widths of Fortran format, such as (3i9,6e20.13).
+std::vector<size_t> parse_format(const std::string &line) {
+	std::vector<size_t> res;
+	size_t i = line.find('(');
+	while (std::string::npos != i && i < line.size()) {
+		size_t j = i+1;
+		const int cnt = std::isdigit(line[j]) ? std::atoi(&line[j]): 1;
+		while (j < line.size() && std::isdigit(line[j])) j++;
+		const int wd = std::atoi(&line[j+1]);
+		for (int k = 0; k < cnt; k++) res.push_back(static_cast<size_t>(wd));
+		i = line.find(',', j);
+	}
+	return res;
+}
+//! Values of fixed width line.
+std::vector<double> split_fixed(const std::string &line, const std::vector<size_t> &wd) {
+	std::vector<double> res;
+	for (size_t i = 0, pos = 0; i < wd.size() && pos < line.size(); pos += wd[i++]) {
+		auto s = line.substr(pos, wd[i]);
+		if (std::string::npos == s.find_first_not_of(" \r")) break;
+		res.push_back(std::atof(s.c_str()));
+	}
+	return res;
+}
+//! Comma separated fields of command.
+std::vector<std::string> split_comma(const std::string &line) {
+	std::vector<std::string> res;
+	size_t i = 0;
+	for (auto j = line.find(','); ; j = line.find(',', i)) {
+		auto s = line.substr(i, std::string::npos == j ? j: j-i);
+		s.erase(std::remove_if(s.begin(), s.end(), [] (char c) { return std::isspace(c);}), s.end());
+		res.push_back(s);
+		if (std::string::npos == j) break;
+		i = j+1;
+	}
+	return res;
+}
+//! Load CDB file, return false when file is not found.
+bool load_cdb(const std::string &fn, CdbModel &m) {
+	std::ifstream fp(fn);
+	if (!fp) return false;
+	std::string line;
+	while (std::getline(fp, line)) {
+		if (0 == line.compare(0, 3, "ET,")) {
+			auto s = split_comma(line);
+			m.etype[std::atoi(s[1].c_str())] = std::atoi(s[2].c_str());
+		} else if (0 == line.compare(0, 7, "MPDATA,")) {
+			auto s = split_comma(line);
+			const int id = std::atoi(s[4].c_str());
+			const double val = std::atof(s[6].c_str());
+			auto &mp = m.matl.emplace(id, std::array<double, 3>{0., 0., 0.}).first->second;
+			if ("DENS" == s[3]) mp[0] = val;
+			if ("EX" == s[3]) mp[1] = val;
+			if ("PRXY" == s[3] || "NUXY" == s[3]) mp[2] = val;
+		} else if (0 == line.compare(0, 8, "RLBLOCK,")) {
+			const int num = std::atoi(split_comma(line)[1].c_str());
+			std::string f1, f2;
+			std::getline(fp, f1);
+			std::getline(fp, f2);
+			auto w1 = parse_format(f1), w2 = parse_format(f2);
+			for (int i = 0; i < num && std::getline(fp, line); i++) {
+				auto v = split_fixed(line, w1);
+				const int id = static_cast<int>(v[0]);
+				const size_t nv = static_cast<size_t>(v[1]);
+				std::vector<double> val(v.begin()+2, v.end());
+				while (val.size() < nv && std::getline(fp, line)) {
+					for (auto x: split_fixed(line, w2)) val.push_back(x);
+				}
+				m.rconst[id] = val;
+			}
+		} else if (0 == line.compare(0, 7, "NBLOCK,")) {
+			std::getline(fp, line);
+			auto wd = parse_format(line);
+			while (std::getline(fp, line) && 0 != line.compare(0, 2, "N,")) {
+				auto v = split_fixed(line, wd);
+				std::array<double, 3> x{0., 0., 0.};
+				for (size_t i = 3; i < std::min<size_t>(6, v.size()); i++) x[i-3] = v[i];
+				m.xyz[static_cast<int>(v[0])] = x;
+			}
+		} else if (0 == line.compare(0, 7, "EBLOCK,")) {
+			std::getline(fp, line);
+			auto wd = parse_format(line);
+			while (std::getline(fp, line)) {
+				auto v = split_fixed(line, wd);
+				if (v.size() < 11 || 0 > v[0]) break;
+				CdbModel::Cell c{static_cast<int>(v[10]), static_cast<int>(v[0]),
+					static_cast<int>(v[1]), static_cast<int>(v[2]), {}};
+				for (size_t i = 11; i < v.size() && c.nodes.size() < static_cast<size_t>(v[8]); i++) {
+					c.nodes.push_back(static_cast<int>(v[i]));
+				}
+				m.elem.push_back(c);
+			}
+		}
+	}
+	return true;
+}
+//! Relative difference of matrices.
+double rel_diff(const matrix_<double> &a, const matrix_<double> &b) {
+	const double nb = b.norm();
+	return EPS<double>() < nb ? (a-b).norm()/nb: (a-b).norm();
+}
+//! Form pipe elements of model in double and single precision, return number of elements.
+size_t report(const std::string &fn, int rep) {
+	CdbModel m;
+	if (!load_cdb(fn, m)) {
+		fmt::print("{:<24s} not found\n", fn);
+		return 0;
+	}
+	// Model data in REAL4 as solutions.
+	std::map<int, Node<float, double>> node;
+	for (const auto &it: m.xyz) {
+		node.emplace(it.first, Node<float, double>{it.first, float(it.second[0]), float(it.second[1]), float(it.second[2])});
+	}
+	std::map<int, size_t> dof;
+	for (const auto &it: node) dof.emplace(it.first, 6*dof.size());
+	struct Item {
+		ElementType et;
+		std::vector<Node<float, double>> pt;
+		Material<float> matl;
+		Section<float> sect;
+		std::vector<size_t> loc;
+	};
+	std::vector<Item> list;
+	for (const auto &c: m.elem) {
+		auto et = m.etype.count(c.type) ? m.etype[c.type]: 0;
+		if ((16 != et && 18 != et) || !m.matl.count(c.mat) || !m.rconst.count(c.real)) continue;
+		const auto &mp = m.matl[c.mat];
+		const auto &rc = m.rconst[c.real];
+		Item it{16 == et ? ElementType::PIPE16: ElementType::PIPE18, {},
+			Material<float>(c.mat, MaterialType::LINEAR_ELASTIC, {float(mp[0]), float(mp[1]), 0.f, float(mp[2])}),
+			Section<float>(c.real, SectionType::PIPE, {float(rc[0]), float(rc[1]), float(rc.size() > 2 ? rc[2]: 0.), 0.f, 0.f}), {}};
+		for (size_t i = 0; i < c.nodes.size() && i < size_t(16 == et ? 2: 3); i++) {
+			it.pt.push_back(node.at(c.nodes[i]));
+			it.loc.push_back(dof.at(c.nodes[i]));
+		}
+		list.push_back(it);
+	}
+	// Element and global errors.
+	const auto dim = static_cast<Eigen::Index>(6*dof.size());
+	std::vector<Eigen::Triplet<double>> tri[2];
+	double err[3] = {0., 0., 0.}, sum{0.};
+	for (const auto &it: list) {
+		Element<double> e64(1, it.et, 1, 1, {1}), e32(1, it.et, 1, 1, {1});
+		e32.set_single_precision(true);
+		e64.form_matrix<float>(it.pt.data(), &it.matl, &it.sect);
+		e32.form_matrix<float>(it.pt.data(), &it.matl, &it.sect);
+		const double ek = rel_diff(e32.get_stif(), e64.get_stif());
+		err[0] = std::max(err[0], ek);
+		err[1] = std::max(err[1], rel_diff(e32.get_mass(), e64.get_mass()));
+		err[2] = std::max(err[2], rel_diff(e32.get_tran(), e64.get_tran()));
+		sum += ek;
+		int s{0};
+		for (auto *p: {&e64, &e32}) {
+			matrix_<double> k, ms;
+			vecX_<double> r;
+			p->get_global_matrix(k, ms, r);
+			// Center of PIPE18 has no dof.
+			const size_t nn = static_cast<size_t>(k.rows()/6);
+			for (size_t a = 0; a < nn; a++) {
+				for (size_t b = 0; b < nn; b++) {
+					for (int i = 0; i < 6; i++) {
+						for (int j = 0; j < 6; j++) {
+							tri[s].emplace_back(it.loc[a]+i, it.loc[b]+j, k(6*a+i, 6*b+j));
+						}
+					}
+				}
+			}
+			s++;
+		}
+	}
+	Eigen::SparseMatrix<double> kg[2] = {{dim, dim}, {dim, dim}};
+	for (int s: {0, 1}) kg[s].setFromTriplets(tri[s].begin(), tri[s].end());
+	const double eg = (kg[1]-kg[0]).norm()/std::max(kg[0].norm(), EPS<double>());
+	// Throughput of element formation.
+	double dt[2] = {0., 0.};
+	for (int s: {0, 1}) {
+		Timer t0;
+		for (int r = 0; r < rep; r++) {
+			for (const auto &it: list) {
+				Element<double> e(1, it.et, 1, 1, {1});
+				e.set_single_precision(1 == s);
+				e.form_matrix<float>(it.pt.data(), &it.matl, &it.sect);
+			}
+		}
+		dt[s] = t0.elapsed();
+	}
+	const auto n = list.size();
+	fmt::print("{:<24s}{:>6d}{:>12.3e}{:>12.3e}{:>12.3e}{:>12.3e}{:>12.3e}{:>8.2f}\n", fn.substr(fn.find_last_of('/')+1),
+		n, 0 < n ? sum/n: 0., err[0], err[1], err[2], eg, 0. < dt[1] ? dt[0]/dt[1]: 0.);
+	return n;
+}
+}
+
+/**
+ *  \brief Accuracy of element kernels in single precision on pipe models.
+ *
+ *  Relative Frobenius errors of local stiffness, mass and transform of each
+ *  element, and of assembled global stiffness, against double precision.
+ *  Time ratio is formation time in double over single.
+ *
+ *  Usage: report_mixed_precision [repeats] [CDB files...]
+ */
+int main(int argc, char **argv) {
+	const int rep = 1 < argc ? std::max(1, std::atoi(argv[1])): 100;
+	std::vector<std::string> files;
+	for (int i = 2; i < argc; i++) files.push_back(argv[i]);
+	fmt::print("{:<24s}{:>6s}{:>12s}{:>12s}{:>12s}{:>12s}{:>12s}{:>8s}\n", "Model", "Pipes",
+		"Mean K", "Max K", "Max M", "Max T", "Global K", "Time");
+	size_t num{0};
+	for (const auto &fn: files) num += report(fn, rep);
+	fmt::print("Total pipe elements: {}\n", num);
+	return 0;
+}